@@ -0,0 +1,128 @@
+/**
+ * @file Benchmark.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the Benchmark class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+/**
+ * @brief Construct a new Benchmark:: Benchmark object
+ * 
+ * @param minTime 		- The minimum amount of seconds each benchmark is run for
+ * @param minIterations - The minimum amount of iterations each benchmark is run for
+ * @param filter 		- Only benchmarks containing this string in their name are run, empty runs all
+ */
+Benchmark::Benchmark(double minTime, long long minIterations, const std::string& filter)
+	: minTime(minTime),
+	  minIterations(minIterations),
+	  filter(filter)
+{
+}
+
+/**
+ * @brief Checks wheter or not a benchmark has been selected by the filter.
+ * 
+ * @param name - The name of the benchmark
+ */
+bool Benchmark::enabled(const std::string& name) const
+{
+	return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+/**
+ * @brief Times a benchmark, every iteration is timed on its own. The setup is not part of the timing.
+ * 
+ * @param name 			- The name of the benchmark
+ * @param level 		- The name of the level the benchmark is run on
+ * @param width 		- The width of the level
+ * @param height 		- The height of the level
+ * @param iteration 	- The code that is timed
+ * @param setup 		- Code that is run before every iteration, may be null
+ * @param maxIterations - Upper limit of iterations, for benchmarks that run out of work. -1 for no limit
+ */
+void Benchmark::run(const std::string& name, const std::string& level, int width, int height,
+					const std::function<void()>& iteration, const std::function<void()>& setup, long long maxIterations)
+{
+	if (!enabled(name))
+		return;
+
+	std::cerr << "Running " << name << " on " << level << " (" << width << 'x' << height << ")...\n";
+
+	std::vector <double> samples;
+	double elapsed = 0;
+	while ((elapsed < minTime || (long long)samples.size() < minIterations) &&
+		   (maxIterations < 0 || (long long)samples.size() < maxIterations))
+	{
+		if (setup) setup();
+
+		auto start = std::chrono::steady_clock::now();
+		iteration();
+		auto end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count();
+		samples.push_back(ns);
+		elapsed += ns * 1e-9;
+	}
+
+	BenchmarkResult result = { name, level, width, height, (long long)samples.size(), 0, 0, 0, 0, "" };
+	if (!samples.empty())
+	{
+		double sum = 0;
+		for (double sample : samples) sum += sample;
+		std::sort(samples.begin(), samples.end());
+
+		result.meanNs	= sum / samples.size();
+		result.medianNs = samples[samples.size() / 2];
+		result.minNs	= samples.front();
+		result.maxNs	= samples.back();
+	}
+	results.push_back(result);
+}
+
+/**
+ * @brief Records that a benchmark could not be run, so that it is visible in the results.
+ * 
+ * @param reason - Why the benchmark was skipped
+ */
+void Benchmark::skip(const std::string& name, const std::string& level, int width, int height, const std::string& reason)
+{
+	if (!enabled(name))
+		return;
+
+	std::cerr << "Skipping " << name << " on " << level << ": " << reason << '\n';
+	results.push_back({ name, level, width, height, 0, 0, 0, 0, 0, reason });
+}
+
+/**
+ * @brief Writes all results as a JSON document.
+ * 
+ * @param out - The stream that the JSON is written to
+ */
+void Benchmark::writeJson(std::ostream& out) const
+{
+	out << "{\n  \"benchmarks\": [";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const BenchmarkResult& r = results[i];
+		out << (i ? ",\n" : "\n")
+			<< "    {\"name\": \"" << r.name << "\", \"level\": \"" << r.level << '"'
+			<< ", \"width\": " << r.width << ", \"height\": " << r.height
+			<< ", \"iterations\": " << r.iterations;
+		if (r.skipReason.empty())
+			out << ", \"mean_ns\": " << r.meanNs << ", \"median_ns\": " << r.medianNs
+				<< ", \"min_ns\": " << r.minNs << ", \"max_ns\": " << r.maxNs;
+		else
+			out << ", \"skipped\": \"" << r.skipReason << '"';
+		out << '}';
+	}
+	out << "\n  ]\n}\n";
+}
@@ -0,0 +1,57 @@
+/**
+ * @file Benchmark.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the Benchmark class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The timings of one benchmark on one level.
+ * 
+ */
+struct BenchmarkResult
+{
+	std::string name;
+	std::string level;
+	int			width,
+				height;
+	long long	iterations;
+	double		meanNs,
+				medianNs,
+				minNs,
+				maxNs;
+	std::string skipReason;	//empty unless the benchmark could not be run
+};
+
+/**
+ * @class Benchmark
+ * @brief Runs and times the benchmarks, and writes the results as JSON so that
+ *		  runs from different releases can be compared by a script.
+ */
+class Benchmark
+{
+private:
+	double		minTime;
+	long long	minIterations;
+	std::string filter;
+	std::vector <BenchmarkResult> results;
+public:
+	Benchmark(double minTime, long long minIterations, const std::string& filter);
+
+	bool enabled(const std::string& name) const;
+	void run(const std::string& name, const std::string& level, int width, int height,
+			 const std::function<void()>& iteration,
+			 const std::function<void()>& setup = nullptr,
+			 long long maxIterations = -1);
+	void skip(const std::string& name, const std::string& level, int width, int height, const std::string& reason);
+	void writeJson(std::ostream& out) const;
+};
@@ -0,0 +1,546 @@
+/**
+ * @file benchmarks.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Benchmarks for level loading, the simulation tick and rendering.
+ * 		  Run from the bin directory, as the game itself, so that levels, shaders and sprites are found.
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "Benchmark.h"
+
+#include "src/ScenarioLoader.h"
+#include "src/MazeGenerator.h"
+#include "src/Shader.h"
+#include "src/Maze.h"
+#include "src/JunctionGraph.h"
+#include "src/DistanceField.h"
+#include "src/HierarchicalPathfinder.h"
+#include "src/MazeChunk.h"
+#include "src/MazeRenderer.h"
+#include "src/Camera.h"
+#include "src/ActorStore.h"
+#include "src/ActorSystems.h"
+#include "src/ActorRenderer.h"
+#include "src/GameState.h"
+#include "src/ObservationPlanes.h"
+#include "src/Pellets.h"
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A level the benchmarks are run on.
+ * 
+ */
+struct BenchmarkLevel
+{
+	std::string name;
+	std::string path;
+	int width, height;
+};
+
+/**
+ * @brief Parses a list of sizes on the form "28x36,256x256".
+ * 
+ */
+static std::vector <std::pair<int, int>> parseSizes(const std::string& list)
+{
+	std::vector <std::pair<int, int>> sizes;
+	std::stringstream stream(list);
+	std::string size;
+	while (std::getline(stream, size, ','))
+	{
+		int width = 0, height = 0;
+		if (sscanf(size.c_str(), "%dx%d", &width, &height) == 2 && width > 2 && height > 2)
+			sizes.push_back({ width, height });
+		else
+			std::cerr << "Warning: Ignoring invalid size " << size << '\n';
+	}
+	return sizes;
+}
+
+/**
+ * @brief Runs the benchmarks that require an OpenGL context on one level, the context has to be current.
+ * 
+ * @param bench - The benchmark runner
+ * @param level - The level
+ */
+static void runRenderBenchmarks(Benchmark& bench, const BenchmarkLevel& level)
+{
+	Shader mazeShader("shaders/level01.glsl");
+	Shader pacmanShader("shaders/pacman.glsl");
+	Shader ghostShader("shaders/ghost.glsl");
+	Shader pelletsShader("shaders/pellets.glsl");
+	Renderer renderer;
+
+	ScenarioLoader scenario(level.path);
+
+	Maze maze(&scenario);
+
+	//every chunk of the maze, as when the whole maze is in view
+	bench.run("maze_mesh_generation", level.name, level.width, level.height, [&]() {
+		for (int y = 0; y < maze.getHeight(); y += MazeChunk::size)
+			for (int x = 0; x < maze.getWidth(); x += MazeChunk::size)
+			{
+				MazeChunk chunk(x, y, std::min(MazeChunk::size, maze.getWidth() - x), std::min(MazeChunk::size, maze.getHeight() - y));
+				chunk.build(&maze);
+				chunk.upload();
+			}
+		glFinish();
+	});
+
+	MazeRenderer mazeRenderer(&maze, &mazeShader, &pelletsShader, &renderer);
+	bool largeMaze = maze.getWidth() > 56 || maze.getHeight() > 72;	//the same camera as in the game
+	Camera camera(maze.getWidth(), maze.getHeight(), largeMaze ? 56.f : maze.getWidth(), largeMaze ? 72.f : maze.getHeight());
+
+	ActorStore actors;
+	actors.spawnFromMaze(&maze, 4.f);
+	int pacman = actors.findByKind(pacmanActor);
+	JunctionGraph junctionGraph(&maze);
+	ActorSystems actorSystems(&actors, &maze, &junctionGraph);
+	ActorRenderer actorRenderer(&actors, &renderer);
+	actorRenderer.setSprites(pacmanActor, &pacmanShader, "res/pacman/pacman");
+	actorRenderer.setSprites(ghostActor, &ghostShader, "res/ghost/ghost");
+
+	//the tiles still holding a pellet, Pacman is teleported onto them one by one
+	std::vector <std::pair<int, int>> pelletTiles;
+	for (int y = 0; y < maze.getHeight(); y++)
+		for (int x = 0; x < maze.getWidth(); x++)
+			if (maze.map2d[y][x] == 0)
+				pelletTiles.push_back({ x, y });
+
+	ActorStore spawns = actors;
+	{
+		Pellets pellets(&maze, &mazeRenderer, &actors, pacman);
+		size_t next = 0;
+		bench.run("pellets_has_been_eaten", level.name, level.width, level.height,
+			[&]() { pellets.hasBeenEaten(); },
+			[&]() { actors.tileX[pacman] = pelletTiles[next].first; actors.tileY[pacman] = pelletTiles[next].second; next++; },
+			(long long)pelletTiles.size());
+
+		//starting the level over after every pellet has been eaten, as the game does after a game over
+		bench.run("game_reset", level.name, level.width, level.height,
+			[&]() {
+				pellets.reset();
+				actors = spawns;
+				actorRenderer.reset();
+				actorSystems.seed(1);
+				glFinish();
+			},
+			[&]() {
+				for (auto& tile : pelletTiles)
+				{
+					actors.tileX[pacman] = tile.first; actors.tileY[pacman] = tile.second;
+					pellets.hasBeenEaten();
+				}
+			},
+			100);
+
+		//restores the pellets and Pacman for the remaining benchmarks
+		pellets.reset();
+		actors = spawns;
+	}
+
+	Pellets pellets(&maze, &mazeRenderer, &actors, pacman);
+	const float dt = 1.f / 60.f;
+
+	bench.run("frame", level.name, level.width, level.height, [&]() {
+		camera.follow(actors.getPosX(pacman) + .5f, actors.getPosY(pacman) + .5f);
+		renderer.Clear(.1f, .1f, .1f, 1.f);
+
+		pellets.hasBeenEaten();
+		mazeRenderer.draw(camera);
+
+		actorSystems.update(dt);
+		actorRenderer.animate(dt);
+		actorRenderer.draw(camera);
+		glFinish();	//includes the GPU time, there is no swap for the hidden window
+	});
+
+	//a crowd of ghosts seen all at once, every one of them a different level spawn code but the same sprites
+	std::vector <std::pair<int, int>> freeTiles;
+	for (int y = 0; y < maze.getHeight(); y++)
+		for (int x = 0; x < maze.getWidth(); x++)
+			if (maze.map2d[y][x] != 1)
+				freeTiles.push_back({ x, y });
+	std::mt19937 rng(1);
+	ActorStore crowd;
+	for (int i = 0; i < 4096; i++)
+	{
+		auto& tile = freeTiles[rng() % freeTiles.size()];
+		crowd.add(ghostActor, 3 + i, tile.first, tile.second, 4.f);
+	}
+	ActorRenderer crowdRenderer(&crowd, &renderer);
+	crowdRenderer.setSprites(ghostActor, &ghostShader, "res/ghost/ghost");
+	crowdRenderer.reset();
+	Camera wholeMaze(maze.getWidth(), maze.getHeight(), (float)maze.getWidth(), (float)maze.getHeight());
+	bench.run("actor_draw_4096_ghosts", level.name, level.width, level.height, [&]() {
+		crowdRenderer.animate(dt);
+		crowdRenderer.draw(wholeMaze);
+		glFinish();
+	});
+}
+
+/**
+ * @brief Runs the actor benchmarks on one level, first with the level's own actors
+ * 		  and then with a crowd of ghosts spread over the maze.
+ * 
+ * @param bench - The benchmark runner
+ * @param level - The level
+ */
+static void runActorBenchmarks(Benchmark& bench, const BenchmarkLevel& level)
+{
+	ScenarioLoader scenario(level.path);
+	Maze maze(&scenario);
+
+	//reading the level into a maze, which lists the spawns and pellets as well, and spawning the actors from it
+	bench.run("level_load_and_spawn", level.name, level.width, level.height, [&]() {
+		Maze loaded(&scenario);
+		ActorStore spawned;
+		spawned.spawnFromMaze(&loaded, 4.f);
+	});
+
+	bench.run("junction_graph", level.name, level.width, level.height, [&]() {
+		JunctionGraph graph(&maze);
+	});
+
+	//the pellets left, counted on the int grid and with popcount on the bitboard, and the tiles that can be reached from a tile
+	volatile int remaining = 0;	//so that the counting is not optimized away
+	bench.run("pellet_count_grid", level.name, level.width, level.height, [&]() {
+		int count = 0;
+		for (int y = 0; y < maze.getHeight(); y++)
+			for (int x = 0; x < maze.getWidth(); x++)
+				count += maze.hasPellet(x, y);
+		remaining = count;
+	});
+	bench.run("pellet_count_bitboard", level.name, level.width, level.height, [&]() {
+		remaining = maze.getRemainingPellets();
+	});
+	{
+		const MazeBitboard& bitboard = maze.getBitboard();
+		int startX = 0, startY = 0;
+		for (int tile = 0; tile < maze.getWidth() * maze.getHeight(); tile++)
+			if (maze.isWalkable(tile))
+			{
+				startX = tile % maze.getWidth();
+				startY = tile / maze.getWidth();
+				break;
+			}
+		std::vector <uint64_t> reached;
+		bench.run("bitboard_reachable", level.name, level.width, level.height, [&]() {
+			bitboard.reachable(startX, startY, reached);
+		});
+	}
+
+	ActorStore actors;
+	actors.spawnFromMaze(&maze, 4.f);
+
+	//distance fields from Pacman, from every ghost at once, and the same search over a queue of tiles
+	{
+		DistanceField field(&maze);
+		std::vector <int> pacmanTile, ghostTiles;
+		for (int i = 0; i < actors.size(); i++)
+			(actors.kind[i] == pacmanActor ? pacmanTile : ghostTiles).push_back(maze.getTileIndex(actors.tileX[i], actors.tileY[i]));
+
+		bench.run("distance_field_pacman", level.name, level.width, level.height, [&]() {
+			field.compute(pacmanTile);
+		});
+		bench.run("distance_field_ghosts", level.name, level.width, level.height, [&]() {
+			field.compute(ghostTiles);
+		});
+		bench.run("reachable_fill", level.name, level.width, level.height, [&]() {
+			field.fill(pacmanTile);
+		});
+
+		std::vector <int> distances, queue;
+		bench.run("distance_field_queue", level.name, level.width, level.height, [&]() {
+			distances.assign((size_t)maze.getWidth() * maze.getHeight(), -1);
+			queue.clear();
+			for (int tile : pacmanTile)
+			{
+				distances[tile] = 0;
+				queue.push_back(tile);
+			}
+			for (size_t head = 0; head < queue.size(); head++)
+				for (int d = 0; d < 4; d++)
+				{
+					int neighbour = maze.getNeighbour(queue[head], (Direction)d);
+					if (neighbour != -1 && distances[neighbour] == -1)
+					{
+						distances[neighbour] = distances[queue[head]] + 1;
+						queue.push_back(neighbour);
+					}
+				}
+		});
+	}
+
+	//a door in the middle of the maze, opened and closed again and again, as Maze::setTile() and JunctionGraph::updateTile()
+	{
+		ScenarioLoader editScenario(level.path);
+		Maze editMaze(&editScenario);
+		JunctionGraph editGraph(&editMaze);
+		int doorX = editMaze.getWidth() / 2, doorY = editMaze.getHeight() / 2;
+		bench.run("junction_graph_update", level.name, level.width, level.height, [&]() {
+			editMaze.setTile(doorX, doorY, editMaze.map2d[doorY][doorX] == 1 ? 0 : 1);
+			editGraph.updateTile(editMaze.getTileIndex(doorX, doorY));
+		});
+	}
+
+	//the hierarchical pathfinder, for paths between random tiles, and after a door in the middle has been opened or closed
+	{
+		HierarchicalPathfinder pathfinder(&maze);
+		bench.run("hpa_build", level.name, level.width, level.height, [&]() {
+			pathfinder.build();
+		});
+
+		std::vector <int> walkable;
+		for (int tile = 0; tile < maze.getWidth() * maze.getHeight(); tile++)
+			if (maze.isWalkable(tile))
+				walkable.push_back(tile);
+		std::mt19937 rng(1);
+		HierarchicalPath path;
+		bench.run("hpa_path", level.name, level.width, level.height, [&]() {
+			pathfinder.findPath(walkable[rng() % walkable.size()], walkable[rng() % walkable.size()], path);
+		});
+
+		ScenarioLoader editScenario(level.path);
+		Maze editMaze(&editScenario);
+		HierarchicalPathfinder editPathfinder(&editMaze);
+		int doorX = editMaze.getWidth() / 2, doorY = editMaze.getHeight() / 2;
+		bench.run("hpa_update", level.name, level.width, level.height, [&]() {
+			editMaze.setTile(doorX, doorY, editMaze.map2d[doorY][doorX] == 1 ? 0 : 1);
+			editPathfinder.updateTile(editMaze.getTileIndex(doorX, doorY));
+			editPathfinder.findPath(walkable.front(), walkable.front(), path);
+		});
+	}
+
+	JunctionGraph junctionGraph(&maze);
+	ActorSystems actorSystems(&actors, &maze, &junctionGraph);
+
+	//every ghost has just moved to a new tile, and decides where to go
+	bench.run("ghost_decisions", level.name, level.width, level.height,
+		[&]() { actorSystems.decideGhosts(); },
+		[&]() { std::fill(actors.enteredTile.begin(), actors.enteredTile.end(), 1); });
+
+	bench.run("move_collision_step", level.name, level.width, level.height, [&]() {
+		actorSystems.tick();
+	});
+
+	std::vector <std::pair<int, int>> freeTiles;
+	for (int y = 0; y < maze.getHeight(); y++)
+		for (int x = 0; x < maze.getWidth(); x++)
+			if (maze.map2d[y][x] != 1)
+				freeTiles.push_back({ x, y });
+
+	std::mt19937 rng(1);
+	ActorStore crowd;
+	for (int i = 0; i < 8; i++)
+	{
+		auto& tile = freeTiles[rng() % freeTiles.size()];
+		crowd.add(pacmanActor, 2, tile.first, tile.second, 4.f);
+	}
+	for (int i = 0; i < 4096; i++)
+	{
+		auto& tile = freeTiles[rng() % freeTiles.size()];
+		crowd.add(ghostActor, 3 + i, tile.first, tile.second, 4.f);
+	}
+	ActorSystems crowdSystems(&crowd, &maze, &junctionGraph);
+
+	bench.run("move_collision_step_4096_ghosts", level.name, level.width, level.height, [&]() {
+		crowdSystems.tick();
+	});
+
+	//the same movement with every kernel, the SIMD kernels against the scalar one
+	for (int type = 0; type < movementKernelTypes; type++)
+	{
+		std::string name = std::string("movement_kernel_") + MovementKernel::getName((MovementKernelType)type) + "_4096_ghosts";
+		if (!MovementKernel::isSupported((MovementKernelType)type))
+		{
+			bench.skip(name, level.name, level.width, level.height, "not supported by the CPU");
+			continue;
+		}
+
+		ActorStore kernelCrowd = crowd;
+		ActorSystems kernelSystems(&kernelCrowd, &maze, &junctionGraph);
+		kernelSystems.setMovementKernel((MovementKernelType)type);
+		bench.run(name, level.name, level.width, level.height, [&]() {
+			kernelSystems.move();
+		});
+	}
+
+	//the Pac-Men are revived, so that they are checked every time
+	bench.run("collisions_4096_ghosts", level.name, level.width, level.height,
+		[&]() { crowdSystems.checkCollisions(); },
+		[&]() { std::fill(crowd.alive.begin(), crowd.alive.end(), 1); });
+
+	//the crowd chasing the Pac-Men, every ghost on its own and with the ghosts planning their ways together
+	for (int cooperative = 0; cooperative < 2; cooperative++)
+	{
+		ActorStore chaseCrowd = crowd;
+		ActorSystems chaseSystems(&chaseCrowd, &maze, &junctionGraph);
+		chaseSystems.setChaseDistance(32);
+		chaseSystems.setCooperative(cooperative != 0);
+		bench.run(cooperative ? "cooperative_chase_step_4096_ghosts" : "chase_step_4096_ghosts", level.name, level.width, level.height,
+			[&]() { chaseSystems.tick(); },
+			[&]() { std::fill(chaseCrowd.alive.begin(), chaseCrowd.alive.end(), 1); });
+	}
+
+	//one step of a game in the environment library, 8 ticks with a random action, started over when it is over
+	Maze gameLevel(&scenario);
+	ActorStore gameSpawns;
+	gameSpawns.spawnFromMaze(&gameLevel, 4.f);
+	if (gameSpawns.findByKind(pacmanActor) == -1)
+	{
+		const char* gameBenchmarks[] = { "game_state_step", "game_state_copy", "observation_planes_update", "observation_planes_build" };
+		for (const char* name : gameBenchmarks)
+			bench.skip(name, level.name, level.width, level.height, "the level has no Pacman");
+		return;
+	}
+	GameState game(&gameLevel, &gameSpawns, &junctionGraph);
+	unsigned int gameSeed = 0;
+	bench.run("game_state_step", level.name, level.width, level.height,
+		[&]() { game.step(rng() % 4, 8); },
+		[&]() { if (game.isOver()) game.reset(++gameSeed); });
+
+	//the copy the autopilot makes for every search
+	GameState gameCopy(game);
+	bench.run("game_state_copy", level.name, level.width, level.height, [&]() {
+		gameCopy = game;
+	});
+
+	//the observation of a step, drawn incrementally against drawn from scratch
+	ObservationPlanes observation(game, ObservationSettings());
+	std::vector <unsigned char> observationBuffer(observation.getSize());
+	bench.run("observation_planes_update", level.name, level.width, level.height, [&]() {
+		observation.update(game);
+		observation.write(game, observationBuffer.data());
+	});
+	bench.run("observation_planes_build", level.name, level.width, level.height, [&]() {
+		observation.build(game);
+		observation.write(game, observationBuffer.data());
+	});
+}
+
+int main(int argc, char* argv[])
+{
+	std::string sizeList = "28x36,256x256,1024x1024,4096x4096",
+				filter,
+				outPath;
+	double minTime = 1.0;
+	long long minIterations = 1;
+	bool render = true;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if		(arg == "--sizes"	  && i + 1 < argc) sizeList		 = argv[++i];
+		else if (arg == "--filter"	  && i + 1 < argc) filter		 = argv[++i];
+		else if (arg == "--out"		  && i + 1 < argc) outPath		 = argv[++i];
+		else if (arg == "--min-time"  && i + 1 < argc) minTime		 = std::stod(argv[++i]);
+		else if (arg == "--min-iters" && i + 1 < argc) minIterations = std::stoll(argv[++i]);
+		else if (arg == "--no-render")				   render		 = false;
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--sizes WxH,...] [--filter name] [--out file.json]"
+					  << " [--min-time seconds] [--min-iters n] [--no-render]\n";
+			return -1;
+		}
+	}
+
+	std::vector <BenchmarkLevel> levels;
+	ScenarioLoader level0("levels/level0");
+	levels.push_back({ "level0", "levels/level0", level0.getHorizontalSize(), level0.getVerticalSize() });
+
+	Benchmark bench(minTime, minIterations, filter);
+
+	std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+	for (auto& size : parseSizes(sizeList))
+	{
+		std::string name = "generated_" + std::to_string(size.first) + 'x' + std::to_string(size.second);
+		std::string path = (tempDir / ("assignment_1_" + name)).string();
+
+		MazeGeneratorSettings settings;
+		settings.width = size.first; settings.height = size.second;
+		settings.ghosts = 3;
+		bench.run("maze_generator", name, size.first, size.second, [&]() {
+			MazeGenerator(settings).generate();
+		});
+
+		MazeGenerator(settings).generateScenario().saveMazeMap(path);
+		levels.push_back({ name, path, size.first, size.second });
+	}
+
+	for (auto& level : levels)
+	{
+		bench.run("scenario_loader_parse", level.name, level.width, level.height, [&]() {
+			ScenarioLoader scenario(level.path);
+		});
+
+		ScenarioLoader scenario(level.path);
+		bench.run("maze_generation", level.name, level.width, level.height, [&]() {
+			Maze maze(&scenario);
+		});
+
+		runActorBenchmarks(bench, level);
+	}
+
+	GLFWwindow* window = nullptr;
+	std::string noContext = "disabled with --no-render";
+	if (render)
+	{
+		noContext = "no OpenGL context available";
+		if (glfwInit())
+		{
+			glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);	//renders offscreen, into the hidden window's framebuffer
+			window = glfwCreateWindow(800, 1024, "Benchmarks", NULL, NULL);
+		}
+		if (window)
+		{
+			glfwMakeContextCurrent(window);
+			glfwSwapInterval(0);
+			if (glewInit() != GLEW_OK)
+			{
+				glfwDestroyWindow(window);
+				window = nullptr;
+			}
+		}
+	}
+
+	const char* renderBenchmarks[] = { "maze_mesh_generation", "pellets_has_been_eaten", "game_reset", "frame", "actor_draw_4096_ghosts" };
+	for (auto& level : levels)
+	{
+		if (window)
+			runRenderBenchmarks(bench, level);
+		else
+			for (const char* name : renderBenchmarks)
+				bench.skip(name, level.name, level.width, level.height, noContext);
+	}
+
+	for (size_t i = 1; i < levels.size(); i++)
+		std::remove(levels[i].path.c_str());
+
+	if (render)
+		glfwTerminate();
+
+	if (outPath.empty())
+		bench.writeJson(std::cout);
+	else
+	{
+		std::ofstream out(outPath);
+		bench.writeJson(out);
+	}
+	return 0;
+}
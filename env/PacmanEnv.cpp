@@ -0,0 +1,68 @@
+/**
+ * @file PacmanEnv.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief The C API of the pacman_env shared library, on top of the VectorEnvironment class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "PacmanEnv.h"
+#include "VectorEnvironment.h"
+
+static VectorEnvironment* get(PacmanEnv* env) { return reinterpret_cast<VectorEnvironment*>(env); }
+static const VectorEnvironment* get(const PacmanEnv* env) { return reinterpret_cast<const VectorEnvironment*>(env); }
+
+PacmanEnv* pacmanEnvCreate(const char* levelPath, int envCount, int ticksPerStep)
+{
+	if (!levelPath || envCount < 1 || ticksPerStep < 1)
+		return nullptr;
+
+	VectorEnvironment* environment = new VectorEnvironment(levelPath, envCount, ticksPerStep);
+	if (!environment->isValid())
+	{
+		delete environment;
+		return nullptr;
+	}
+	return reinterpret_cast<PacmanEnv*>(environment);
+}
+
+void pacmanEnvDestroy(PacmanEnv* env)
+{
+	delete get(env);
+}
+
+int pacmanEnvGetCount(const PacmanEnv* env)			  { return get(env)->getCount(); }
+int pacmanEnvGetWidth(const PacmanEnv* env)			  { return get(env)->getWidth(); }
+int pacmanEnvGetHeight(const PacmanEnv* env)		  { return get(env)->getHeight(); }
+
+int pacmanEnvSetObservation(PacmanEnv* env, int downsample, int cropWidth, int cropHeight)
+{
+	ObservationSettings settings;
+	settings.downsample = downsample;
+	settings.cropWidth	= cropWidth;
+	settings.cropHeight = cropHeight;
+	get(env)->setObservationSettings(settings);
+	return get(env)->getObservationSize();
+}
+
+int pacmanEnvGetChannels(const PacmanEnv* env)			{ return get(env)->getChannels(); }
+int pacmanEnvGetObservationWidth(const PacmanEnv* env)	{ return get(env)->getObservationWidth(); }
+int pacmanEnvGetObservationHeight(const PacmanEnv* env) { return get(env)->getObservationHeight(); }
+int pacmanEnvGetObservationSize(const PacmanEnv* env)	{ return get(env)->getObservationSize(); }
+
+void pacmanEnvSetBuffers(PacmanEnv* env, unsigned char* observations, float* rewards, unsigned char* dones)
+{
+	get(env)->setBuffers(observations, rewards, dones);
+}
+
+void pacmanEnvReset(PacmanEnv* env, const unsigned int* seeds)
+{
+	get(env)->reset(seeds);
+}
+
+void pacmanEnvStep(PacmanEnv* env, const int* actions)
+{
+	get(env)->step(actions);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file PacmanEnv.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief The C API of the pacman_env shared library, the game as a vectorized environment for training agents.
+ * 		  Many games of the same level are stepped together with one call. The observations, rewards and dones
+ * 		  are written in place into buffers owned by the caller, so nothing is copied or allocated per step.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+
+#if defined(_WIN32)
+	#ifdef PACMAN_ENV_BUILD
+		#define PACMAN_ENV_API __declspec(dllexport)
+	#else
+		#define PACMAN_ENV_API __declspec(dllimport)
+	#endif
+#else
+	#define PACMAN_ENV_API __attribute__((visibility("default")))
+#endif
+
+/* The actions, the same values as the directions of the game */
+#define PACMAN_ENV_UP		0
+#define PACMAN_ENV_DOWN		1
+#define PACMAN_ENV_RIGHT	2
+#define PACMAN_ENV_LEFT		3
+#define PACMAN_ENV_NOOP		4	/* Pacman keeps going in its direction */
+
+/* The channels of the observations, every ghost has its own channel from PACMAN_ENV_GHOSTS on */
+#define PACMAN_ENV_WALLS	0
+#define PACMAN_ENV_PELLETS	1
+#define PACMAN_ENV_PACMAN	2
+#define PACMAN_ENV_GHOSTS	3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct PacmanEnv PacmanEnv;
+
+/*
+ * Creates envCount games of a level. Every step runs ticksPerStep ticks of the game (there are 128 ticks per second).
+ * Returns NULL if the level could not be loaded or has no Pacman.
+ */
+PACMAN_ENV_API PacmanEnv* pacmanEnvCreate(const char* levelPath, int envCount, int ticksPerStep);
+PACMAN_ENV_API void		  pacmanEnvDestroy(PacmanEnv* env);
+
+PACMAN_ENV_API int pacmanEnvGetCount(const PacmanEnv* env);
+PACMAN_ENV_API int pacmanEnvGetWidth(const PacmanEnv* env);		/* the size of the maze, in tiles */
+PACMAN_ENV_API int pacmanEnvGetHeight(const PacmanEnv* env);
+
+/*
+ * Sets how the observations are made, and starts every game over. Every cell of an observation covers
+ * downsample x downsample tiles, and with cropWidth and cropHeight (in cells) the observation is a window centered on Pacman.
+ * By default the observations are the whole maze, not downsampled. Returns the new observation size.
+ * The buffers have to be set again afterwards.
+ */
+PACMAN_ENV_API int pacmanEnvSetObservation(PacmanEnv* env, int downsample, int cropWidth, int cropHeight);
+
+/*
+ * An observation is uint8 planes, channel by channel and row by row: 255 where an actor is, and for the walls and pellets
+ * the share of the cell's tiles that have one.
+ */
+PACMAN_ENV_API int pacmanEnvGetChannels(const PacmanEnv* env);
+PACMAN_ENV_API int pacmanEnvGetObservationWidth(const PacmanEnv* env);
+PACMAN_ENV_API int pacmanEnvGetObservationHeight(const PacmanEnv* env);
+PACMAN_ENV_API int pacmanEnvGetObservationSize(const PacmanEnv* env);	/* bytes per game */
+
+/*
+ * Sets the buffers the games are written to, they have to stay valid until they are replaced or the env is destroyed:
+ * observations - envCount * pacmanEnvGetObservationSize bytes
+ * rewards 		- envCount floats, the pellets eaten during the step
+ * dones 		- envCount bytes, 1 when the game was over after the step
+ */
+PACMAN_ENV_API void pacmanEnvSetBuffers(PacmanEnv* env, unsigned char* observations, float* rewards, unsigned char* dones);
+
+/*
+ * Starts every game over, with one seed per game for the ghosts, and writes the first observations.
+ * With seeds NULL, every game is started with the seed it was last started with.
+ */
+PACMAN_ENV_API void pacmanEnvReset(PacmanEnv* env, const unsigned int* seeds);
+
+/*
+ * Steps every game with one action per game. A game that is over is started over right away, with a new seed,
+ * so its observation is the start of the next game while its done is 1.
+ */
+PACMAN_ENV_API void pacmanEnvStep(PacmanEnv* env, const int* actions);
+
+#ifdef __cplusplus
+}
+#endif
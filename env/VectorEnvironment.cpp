@@ -0,0 +1,158 @@
+/**
+ * @file VectorEnvironment.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the VectorEnvironment class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "VectorEnvironment.h"
+
+#include <fstream>
+#include <iostream>
+
+/**
+ * @brief Construct a new Vector Environment:: Vector Environment object.
+ * 		  If the level can not be loaded, is cut short, or has no Pacman, no games are made (see isValid()).
+ *
+ * @param levelPath    - The path to the level file
+ * @param count 	   - The amount of games
+ * @param ticksPerStep - The amount of ticks every step runs
+ */
+VectorEnvironment::VectorEnvironment(const std::string& levelPath, int count, int ticksPerStep)
+	: scenario(nullptr),
+	  level(nullptr),
+	  junctionGraph(nullptr),
+	  ticksPerStep(ticksPerStep),
+	  observations(nullptr),
+	  rewards(nullptr),
+	  dones(nullptr)
+{
+	if (!std::ifstream(levelPath))
+	{
+		std::cout << "Warning: Could not open " << levelPath << '\n';
+		return;
+	}
+
+	scenario = new ScenarioLoader(levelPath);
+	if (!scenario->isComplete())
+	{
+		std::cout << "Warning: The level " << levelPath << " ends before its last tile, or has something else than a number\n";
+		return;
+	}
+
+	level = new Maze(scenario);
+	spawns.spawnFromMaze(level, 4.f);
+	junctionGraph = new JunctionGraph(level);
+
+	if (spawns.findByKind(pacmanActor) == -1)
+	{
+		std::cout << "Warning: The level " << levelPath << " has no Pacman (2)\n";
+		return;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		games.push_back(new GameState(level, &spawns, junctionGraph));
+		planes.push_back(new ObservationPlanes(*games.back(), ObservationSettings()));
+		seeds.push_back(i);
+	}
+}
+
+/**
+ * @brief Destroy the Vector Environment:: Vector Environment object
+ *
+ */
+VectorEnvironment::~VectorEnvironment()
+{
+	for (GameState* game : games)
+		delete game;
+	for (ObservationPlanes* observation : planes)
+		delete observation;
+	delete junctionGraph;
+	delete level;
+	delete scenario;
+}
+
+/**
+ * @brief Sets how the observations are made, and starts every game over with the seed it was last started with.
+ * 		  The buffers are dropped, as they were made for the old observation size.
+ *
+ * @param settings - The downsampling and the window around Pacman
+ */
+void VectorEnvironment::setObservationSettings(const ObservationSettings& settings)
+{
+	setBuffers(nullptr, nullptr, nullptr);
+	for (int i = 0; i < getCount(); i++)
+	{
+		delete planes[i];
+		planes[i] = new ObservationPlanes(*games[i], settings);
+	}
+	reset(nullptr);
+}
+
+/**
+ * @brief Sets the buffers the games are written to, see pacmanEnvSetBuffers().
+ *
+ * @param observations - getObservationSize() bytes per game
+ * @param rewards 	   - One per game
+ * @param dones 	   - One per game
+ */
+void VectorEnvironment::setBuffers(unsigned char* observations, float* rewards, unsigned char* dones)
+{
+	this->observations = observations;
+	this->rewards = rewards;
+	this->dones = dones;
+}
+
+/**
+ * @brief Starts every game over and writes its observation. The rewards and dones are cleared.
+ *
+ * @param seeds - One seed per game, or nullptr to keep the seeds the games were last started with
+ */
+void VectorEnvironment::reset(const unsigned int* seeds)
+{
+	for (int i = 0; i < getCount(); i++)
+	{
+		if (seeds) this->seeds[i] = seeds[i];
+		games[i]->reset(this->seeds[i]);
+		planes[i]->build(*games[i]);
+
+		if (rewards) rewards[i] = 0.f;
+		if (dones)	 dones[i] = 0;
+		if (observations) planes[i]->write(*games[i], observations + (size_t)i * getObservationSize());
+	}
+}
+
+/**
+ * @brief Steps every game and writes its observation, reward and done.
+ * 		  A game that is over starts over with its seed increased by the amount of games,
+ * 		  so that no two games share a seed when they were started with different ones.
+ *
+ * @param actions - One direction per game, anything else keeps Pacman going
+ */
+void VectorEnvironment::step(const int* actions)
+{
+	for (int i = 0; i < getCount(); i++)
+	{
+		GameState& game = *games[i];
+		int action = actions[i] >= up && actions[i] <= left ? actions[i] : GameState::noAction;
+		int eaten = game.step(action, ticksPerStep);
+
+		bool over = game.isOver();
+		if (over)
+		{
+			seeds[i] += getCount();
+			game.reset(seeds[i]);
+			planes[i]->build(game);
+		}
+		else
+			planes[i]->update(game);
+
+		if (rewards) rewards[i] = (float)eaten;
+		if (dones)	 dones[i] = over;
+		if (observations) planes[i]->write(game, observations + (size_t)i * getObservationSize());
+	}
+}
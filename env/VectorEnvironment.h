@@ -0,0 +1,59 @@
+/**
+ * @file VectorEnvironment.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the VectorEnvironment class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "src/ScenarioLoader.h"
+#include "src/Maze.h"
+#include "src/ActorStore.h"
+#include "src/JunctionGraph.h"
+#include "src/GameState.h"
+#include "src/ObservationPlanes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @class VectorEnvironment
+ * @brief Many GameStates of the same level, stepped together. The level is loaded and compiled once,
+ * 		  and every game starts over from it. Used through the C API in PacmanEnv.h.
+ */
+class VectorEnvironment
+{
+private:
+	ScenarioLoader*			   scenario;
+	Maze*					   level;			//the level as loaded, with the spawns taken out
+	ActorStore				   spawns;
+	JunctionGraph*			   junctionGraph;
+	std::vector <GameState*>   games;
+	std::vector <ObservationPlanes*> planes;	//per game, its observation
+	std::vector <unsigned int> seeds;			//per game, the seed it was last started with
+	int						   ticksPerStep;
+
+	unsigned char*			   observations;	//the caller's buffers
+	float*					   rewards;
+	unsigned char*			   dones;
+public:
+	VectorEnvironment(const std::string& levelPath, int count, int ticksPerStep);
+	~VectorEnvironment();
+
+	bool isValid() const { return !games.empty(); }
+	int  getCount() const { return (int)games.size(); }
+	int  getWidth() const { return level->getWidth(); }
+	int  getHeight() const { return level->getHeight(); }
+	int  getChannels() const { return planes[0]->getChannels(); }
+	int  getObservationWidth() const { return planes[0]->getWidth(); }
+	int  getObservationHeight() const { return planes[0]->getHeight(); }
+	int  getObservationSize() const { return planes[0]->getSize(); }
+
+	void setObservationSettings(const ObservationSettings& settings);
+	void setBuffers(unsigned char* observations, float* rewards, unsigned char* dones);
+	void reset(const unsigned int* seeds);
+	void step(const int* actions);
+};
@@ -1,11 +1,20 @@
 #include "src/ScenarioLoader.h"
+#include "src/MazeGenerator.h"
 #include "src/Shader.h"
 
 #include "src/Maze.h"
-#include "src/MovableObject.h"
-#include "src/Pacman.h"
-#include "src/Ghost.h"
+#include "src/JunctionGraph.h"
+#include "src/MazeRenderer.h"
+#include "src/Camera.h"
+#include "src/ActorStore.h"
+#include "src/ActorSystems.h"
+#include "src/ActorRenderer.h"
+#include "src/GameState.h"
+#include "src/Autopilot.h"
+#include "src/GameEvents.h"
 #include "src/Pellets.h"
+#include "src/Campaign.h"
+#include "src/LevelWatcher.h"
 #include "src/stb_image.h"
 
 #include <GL/glew.h>
@@ -15,12 +24,59 @@
 #include <glm/gtc/type_ptr.hpp>
 
 
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 
-int main(void)
+int main(int argc, char* argv[])
 {
+	//optional arguments for playing another campaign, or a generated maze
+	MazeGeneratorSettings generatorSettings;
+	bool generate = false;
+	std::string campaignPath = "levels/campaign", savePath;
+	float autopilotBudget = 0.f;
+	bool editing = false, watching = false;
+	int chaseDistance = 0;
+	bool hunting = false;
+	bool cooperative = false;
+	bool validArguments = true;
+	try
+	{
+		for (int i = 1; i < argc && validArguments; i++)
+		{
+			std::string arg = argv[i];
+			if (arg == "--generate" && i + 1 < argc &&
+				sscanf(argv[++i], "%dx%d", &generatorSettings.width, &generatorSettings.height) == 2)
+				generate = true;
+			else if (arg == "--seed" && i + 1 < argc)	generatorSettings.seed = std::stoul(argv[++i]);
+			else if (arg == "--ghosts" && i + 1 < argc)	generatorSettings.ghosts = std::stoi(argv[++i]);
+			else if (arg == "--save" && i + 1 < argc)	savePath = argv[++i];
+			else if (arg == "--campaign" && i + 1 < argc) campaignPath = argv[++i];
+			else if (arg == "--edit")					editing = true;
+			else if (arg == "--watch")					watching = true;
+			else if (arg == "--autopilot" && i + 1 < argc) autopilotBudget = std::stof(argv[++i]) / 1000.f;
+			else if (arg == "--chase" && i + 1 < argc)	chaseDistance = std::stoi(argv[++i]);
+			else if (arg == "--hunt")					hunting = true;
+			else if (arg == "--cooperative")			cooperative = true;
+			else										validArguments = false;
+		}
+	}
+	catch (const std::exception& error)	//a number that could not be read, or is out of range
+	{
+		std::cout << "Error: Invalid number in the arguments (" << error.what() << ")\n";
+		validArguments = false;
+	}
+	if (!validArguments)
+	{
+		std::cout << "Usage: " << argv[0] << " [--campaign manifest|directory] [--generate WxH] [--seed n] [--ghosts n] [--save levelfile] [--autopilot ms] [--chase tiles] [--cooperative] [--hunt] [--edit] [--watch]\n";
+		return -1;
+	}
+
 	GLFWwindow* window;
 
 	/* Initialize the library */
@@ -57,69 +113,250 @@ int main(void)
 
 	Shader mazeShader("shaders/level01.glsl"); //Parses shaders from file
 	Shader pacmanShader("shaders/pacman.glsl");
+	Shader ghostShader("shaders/ghost.glsl");
 	Shader pelletsShader("shaders/pellets.glsl");
 
-	ScenarioLoader mazeScenario("levels/level0"); //loads the level from file
-
 	Renderer renderer;
 
+	//the levels are played one after the other, the next one is loaded in the background
+	ActorStore actors;
+	Campaign campaign(&mazeShader, &pelletsShader, &renderer, &actors);
+	campaign.setHunting(hunting);	//with --hunt, every ghost finds its way to Pacman with a HierarchicalPathfinder
+	if (generate)
+		campaign.addLevel(generatorSettings);
+	else if (!campaign.load(campaignPath))
+		campaign.addLevel("levels/level0");
 
-	Maze maze(&mazeScenario, &mazeShader, &renderer); //generates the maze
-
-	std::vector <Shader*> ghostShaders;
-	std::vector <MovableObject*> ghosts;
-	for (int i = 0; i < 3; i++)
+	CampaignLevel* level = campaign.loadFirst();
+	if (!level)
 	{
-		ghostShaders.push_back(new Shader("shaders/ghost.glsl"));
-		ghosts.push_back(new Ghost(&maze, ghostShaders[i], &renderer, 3 + i, "res/ghost/ghost"));
+		std::cout << "Error: None of the levels could be played\n";
+		glfwTerminate();
+		return -1;
 	}
-	
-	MovableObject* pacman = new Pacman(&maze, &pacmanShader, &renderer,2,window,"res/pacman/pacman",ghosts);
-	
-	Pellets pellets(&maze, &pelletsShader, &renderer,pacman);
-	
-	int maxPellets = pellets.getScore(); bool havePrintedFinalScore = false;
-
-	srand(time(NULL)); //sets a random seed for future rand() calls.
+	if (!savePath.empty())
+		level->scenario->saveMazeMap(savePath);
+
+	ActorRenderer actorRenderer(&actors, &renderer);
+	actorRenderer.setSprites(pacmanActor, &pacmanShader, "res/pacman/pacman");
+	actorRenderer.setSprites(ghostActor, &ghostShader, "res/ghost/ghost");
+
+	//the simulation sends what happens as events, drained once per frame. Every level's systems and pellets use the same rings
+	GameEvents events;
+	GameEventRing* systemsEvents = events.addProducer();
+	GameEventRing* pelletsEvents = events.addProducer();
+	std::vector <GameEvent> frameEvents;
+
+	//the autopilot plays instead of the keyboard, searching on copies of the game for the given milliseconds per decision
+	GameState* autopilotGame = nullptr;
+	Autopilot* autopilot = nullptr;
+
+	//with --watch, the changes saved to the level file are made in the running game
+	LevelWatcher* watcher = nullptr;
+	std::vector <TileChange> tileChanges;
+
+	int pacman = -1, levelNumber = 0, maxPellets = 0, eatenPellets = 0; bool playing = false;
+	unsigned int levelSeed = 0;
+
+	//plays the level again from its start, with the same seed for the ghosts. Every asset and GPU buffer is kept,
+	//only the eaten pellets are put back
+	auto restartLevel = [&]()
+	{
+		level->pellets->reset();
+		actors = level->spawns;
+		actorRenderer.reset();
+		level->systems->seed(levelSeed);
+
+		maxPellets = level->pellets->getScore(); eatenPellets = 0; playing = true;
+		glfwSetTime(0);
+	};
+
+	auto startLevel = [&]()
+	{
+		pacman = level->pacman;
+		level->systems->setEventRing(systemsEvents);
+		level->pellets->setEventRing(pelletsEvents);
+		level->systems->setChaseDistance(chaseDistance);	//with --chase, the ghosts close to Pacman go after Pacman
+		level->systems->setCooperative(cooperative);		//with --cooperative as well, they plan their ways together
+		levelSeed = (unsigned int)time(NULL) + levelNumber; //a random seed for the ghosts
+
+		delete autopilot;
+		delete autopilotGame;
+		autopilot = nullptr;
+		autopilotGame = nullptr;
+		if (autopilotBudget > 0.f)
+		{
+			AutopilotSettings autopilotSettings;
+			autopilotSettings.budget = autopilotBudget;
+			autopilotGame = new GameState(level->maze, &level->spawns, level->junctionGraph);
+			autopilotGame->setChaseDistance(chaseDistance);
+			autopilotGame->setCooperative(cooperative);
+			autopilot = new Autopilot(*autopilotGame, autopilotSettings);
+		}
+
+		delete watcher;
+		watcher = nullptr;
+		if (watching && !level->path.empty())
+			watcher = new LevelWatcher(level->path, level->maze->getWidth(), level->maze->getHeight(), level->scenario->mazeMap);
+
+		std::cout << "Level " << ++levelNumber << ": " << level->name << '\n';
+		restartLevel();
+	};
+	startLevel();
+	campaign.prepareNext();
+
+	//a cleared level stays on screen until the next one is loaded, its meshes are then sent to the GPU over a few frames
+	const int	 mazeChunksPerFrame = 2;
+	CampaignLevel* upcoming = nullptr;
+	bool switching = false;
+
 	double dt = 0;
-	glfwSetTime(0);
 	/* Loop until the user closes the window */
 	while (!glfwWindowShouldClose(window))
 	{
-		if (pacman->alive && !pellets.allPelletsGone())
+		//the events of one producer are in order, but not between the producers, so the outcome is decided after all of them
+		bool caught = false, cleared = false;
+		events.drain(frameEvents);
+		for (const GameEvent& event : frameEvents)
 		{
-			dt = glfwGetTime();
-			glfwSetTime(0); //sets time to 0 to check elapsed time until next glfwGetTime()
+			switch (event.type)
+			{
+				case pelletEaten:  eatenPellets++; break;
+				case pacmanCaught: caught = true;  break;
+				case levelCleared: cleared = true; break;
+			}
 		}
-		else
+		if (playing && (caught || cleared))
 		{
-			if (!havePrintedFinalScore)
+			playing = false;
+			if (cleared && campaign.hasNext())
+			{
+				switching = true;
+				std::cout << "Level cleared!\n";
+			}
+			else
 			{
-				havePrintedFinalScore = true;
-				if (pellets.getScore() == 0)
+				if (cleared)
 					std::cout << "Congratulations! You ate all pellets!\n";
 				else
-					std::cout << "Game over! You ate " << maxPellets - pellets.getScore() << '/' << maxPellets << " pellets.\n";
-				std::cout << "Press ESC to exit the application...\n";
+					std::cout << "Game over! You ate " << eatenPellets << '/' << maxPellets << " pellets.\n";
+				if (!autopilot)
+					std::cout << "Press R to play the level again, or ESC to exit the application...\n";
 			}
-			dt = 0;
 		}
-		/* Render here */
-		renderer.Clear(.1f, .1f, .1f, 1.f);
-		
-		maze.draw();
-		pellets.draw();
 
-		pacman->move(4.f, dt);
-		pacman->draw();
+		//the autopilot starts over by itself, for demos
+		if (!playing && !switching && (autopilot || glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS))
+			restartLevel();
 
+		if (switching)
+		{
+			if (!upcoming && campaign.isNextReady())
+			{
+				upcoming = campaign.takeNext();
+				if (!upcoming)
+				{
+					switching = false;
+					std::cout << "Congratulations! You ate all pellets!\n";
+					std::cout << "Press ESC to exit the application...\n";
+				}
+			}
+			if (upcoming)
+			{
+				if (upcoming->mazeRenderer->upload(*upcoming->camera, mazeChunksPerFrame))
+				{
+					delete level;
+					level = upcoming;
+					upcoming = nullptr;
+					switching = false;
+					startLevel();
+					campaign.prepareNext();
+				}
+			}
+		}
 
-		for (int i = 0; i < ghosts.size(); i++)
+		if (watcher && watcher->takeChanges(tileChanges))
 		{
-			ghosts[i]->move(4.f, dt);
-			ghosts[i]->draw();
+			//only walls that are built or opened change the game: an opened wall gets a pellet, eaten pellets stay eaten,
+			//and a moved spawn changes nothing, the actors stay where they are
+			for (const TileChange& change : tileChanges)
+				if ((change.value == 1) != (level->maze->map2d[change.y][change.x] == 1))
+					level->setTile(change.x, change.y, change.value == 1 ? 1 : 0);
+			int respawned = level->respawnBlockedActors(&actors);
+			std::cout << "Reloaded " << level->path << ", " << tileChanges.size() << " tiles changed";
+			if (respawned) std::cout << ", " << respawned << " actors put back on their spawns";
+			std::cout << '\n';
 		}
 
+		if (playing)
+		{
+			dt = glfwGetTime();
+			glfwSetTime(0); //sets time to 0 to check elapsed time until next glfwGetTime()
+		}
+		else
+			dt = 0;
+		Camera& camera = *level->camera;
+		ActorSystems& actorSystems = *level->systems;
+		if (glfwGetKey(window, GLFW_KEY_EQUAL) == GLFW_PRESS) camera.zoom(1.02f);
+		if (glfwGetKey(window, GLFW_KEY_MINUS) == GLFW_PRESS) camera.zoom(1.f / 1.02f);
+		if (autopilot)
+		{
+			//decides where to turn every time Pacman moves to a new tile
+			if (actors.alive[pacman] && actors.enteredTile[pacman])
+			{
+				actors.enteredTile[pacman] = 0;
+				autopilotGame->copyFrom(*level->maze, actors);
+				actorSystems.turn(pacman, autopilot->decide(*autopilotGame));
+			}
+		}
+		else
+		{
+			if (glfwGetKey(window, GLFW_KEY_UP)	   == GLFW_PRESS) actorSystems.steer(pacman, up);
+			if (glfwGetKey(window, GLFW_KEY_DOWN)  == GLFW_PRESS) actorSystems.steer(pacman, down);
+			if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS) actorSystems.steer(pacman, right);
+			if (glfwGetKey(window, GLFW_KEY_LEFT)  == GLFW_PRESS) actorSystems.steer(pacman, left);
+		}
+
+		//with --edit the left mouse button builds walls and the right one opens them up, while the game goes on
+		bool buildWall = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS,
+			 openWall = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS;
+		if (editing && (buildWall || openWall))
+		{
+			double cursorX, cursorY; int windowWidth, windowHeight;
+			glfwGetCursorPos(window, &cursorX, &cursorY);
+			glfwGetWindowSize(window, &windowWidth, &windowHeight);
+			int x = (int)std::floor(camera.getLeft() + cursorX / windowWidth * camera.getVisibleWidth()),
+				y = (int)std::floor(camera.getTop() + cursorY / windowHeight * camera.getVisibleHeight());
+
+			Maze& maze = *level->maze;
+			if (x >= 0 && y >= 0 && x < maze.getWidth() && y < maze.getHeight())
+			{
+				//no walls on an actor, or on the tile it is moving into
+				int tile = maze.getTileIndex(x, y);
+				bool occupied = false;
+				for (int i = 0; i < actors.size(); i++)
+				{
+					int actorTile = maze.getTileIndex(actors.tileX[i], actors.tileY[i]);
+					occupied |= actors.alive[i] && (actorTile == tile || maze.getNeighbour(actorTile, actors.direction[i]) == tile);
+				}
+				if (buildWall && !occupied)
+					level->setTile(x, y, 1);
+				else if (openWall && maze.map2d[y][x] == 1)
+					level->setTile(x, y, 0);
+			}
+		}
+		camera.follow(actors.getPosX(pacman) + .5f, actors.getPosY(pacman) + .5f);
+
+		/* Render here */
+		renderer.Clear(.1f, .1f, .1f, 1.f);
+		
+		level->pellets->hasBeenEaten();
+		level->mazeRenderer->draw(camera);
+
+		actorSystems.update(dt);
+		actorRenderer.animate(dt);
+		actorRenderer.draw(camera);
+
 		glfwSwapBuffers(window);
 
 		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
@@ -133,6 +370,12 @@ int main(void)
 
 	}
 
+	delete watcher;
+	delete autopilot;
+	delete autopilotGame;
+	delete upcoming;
+	delete level;
+
 	glfwTerminate();
 	return 0;
 }
\ No newline at end of file
@@ -3,8 +3,11 @@
 
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 texCoord;
+layout (location = 2) in vec2 aOffset;		//per actor, its position in tiles
+layout (location = 3) in float aSprite;		//per actor, the layer of the sprites it shows
 
 out vec2 v_TexCoord;
+flat out float v_Sprite;
 
 uniform mat4 u_TransformationMat = mat4(1);
 uniform mat4 u_ViewMat           = mat4(1);
@@ -14,8 +17,9 @@ uniform mat4 u_Scale			 = mat4(1);
 
 void main()
 {
-	gl_Position = u_ProjectionMat * u_ViewMat * u_TransformationMat * u_Scale * vec4(aPos.x, aPos.y, aPos.z, 1.0);
+	gl_Position = u_ProjectionMat * u_ViewMat * (u_TransformationMat * u_Scale * vec4(aPos.x, aPos.y, aPos.z, 1.0) + vec4(aOffset, 0.0, 0.0));
 	v_TexCoord = texCoord;
+	v_Sprite = aSprite;
 };
 
 
@@ -25,12 +29,13 @@ void main()
 layout (location = 0) out vec4 FragColor;
 
 in vec2 v_TexCoord;
+flat in float v_Sprite;
 
 uniform vec4 u_Color;
-uniform sampler2D u_Texture;
+uniform sampler2DArray u_Texture;
 
 void main()
 {
-   vec4 texColor = texture(u_Texture, v_TexCoord);
+   vec4 texColor = texture(u_Texture, vec3(v_TexCoord, v_Sprite));
    FragColor = texColor;
 };
\ No newline at end of file
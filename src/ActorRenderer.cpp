@@ -0,0 +1,154 @@
+/**
+ * @file ActorRenderer.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the ActorRenderer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "ActorRenderer.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @brief Construct a new Actor Renderer:: Actor Renderer object, and the quad every actor is drawn with.
+ *
+ * @param store 	- The actors that are drawn
+ * @param renderer 	- The actors' renderer
+ */
+ActorRenderer::ActorRenderer(ActorStore* store, Renderer* renderer)
+	: m_Store(store),
+	  m_Renderer(renderer),
+	  instanceCapacity(0)
+{
+	for (int kind = 0; kind < actorKinds; kind++)
+	{
+		m_Shaders[kind] = nullptr;
+		animators[kind] = nullptr;
+	}
+
+	TexturedVertex quadVertices[4] = {
+		{ { 0, 0 }, { 0,	 65535 } },	//position, texture
+		{ { 1, 0 }, { 65535, 65535 } },
+		{ { 0, 1 }, { 0,	 0	   } },
+		{ { 1, 1 }, { 65535, 0	   } }
+	};
+	unsigned int quadIndices[6] = { 0, 1, 2, 1, 2, 3 };
+
+	quadVAO = new VertexArray;
+	quadVAO->Bind();
+	quadVBO = new VertexBuffer(quadVertices, sizeof(quadVertices));
+	quadVBO->Bind();
+	quadVAO->AddBuffer<TexturedVertex>(*quadVBO);
+
+	quadIBO = new IndexBuffer(quadIndices, 6, 4);
+
+	instanceVBO = new VertexBuffer(nullptr, 0);	//made large enough when the actors are drawn
+	quadVAO->AddInstanceBuffer<ActorInstance>(*instanceVBO, 2);
+}
+
+/**
+ * @brief Destroy the Actor Renderer:: Actor Renderer object
+ *
+ */
+ActorRenderer::~ActorRenderer()
+{
+	delete quadVAO;
+	delete quadVBO;
+	delete quadIBO;
+	delete instanceVBO;
+	for (int kind = 0; kind < actorKinds; kind++)
+		delete animators[kind];
+}
+
+/**
+ * @brief Sets the shader and sprites used for every actor of a kind.
+ *
+ * @param kind 			- The kind of actor
+ * @param shader 		- The shader
+ * @param spritePaths 	- A path to the file containing the sprite filepaths
+ */
+void ActorRenderer::setSprites(ActorKind kind, Shader* shader, const std::string& spritePaths)
+{
+	m_Shaders[kind] = shader;
+	m_Shaders[kind]->createShaderProgram();
+	m_Shaders[kind]->setUniform1i("u_Texture", 0);
+	m_Shaders[kind]->setUniformMat4("u_TransformationMat", glm::mat4(1.f));	//the actors are moved by their instances
+
+	delete animators[kind];
+	animators[kind] = new Animator(spritePaths);
+}
+
+/**
+ * @brief Advances the animation of every living actor.
+ *
+ * @param dt - Delta time (time elapsed since the last iteration)
+ */
+void ActorRenderer::animate(float dt)
+{
+	animations.resize(m_Store->size());
+	for (int i = 0; i < m_Store->size(); i++)
+		if (m_Store->alive[i] && animators[m_Store->kind[i]])
+			animators[m_Store->kind[i]]->animate(animations[i], m_Store->direction[i], dt);
+}
+
+/**
+ * @brief Starts every animation over, for when the actors are put back on their spawns.
+ *
+ */
+void ActorRenderer::reset()
+{
+	animations.assign(m_Store->size(), AnimationState());
+}
+
+/**
+ * @brief Draws the actors that are visible to the camera, one instanced draw call per kind.
+ *
+ * @param camera - The camera deciding what is visible
+ */
+void ActorRenderer::draw(const Camera& camera)
+{
+	animations.resize(m_Store->size());
+	instances.clear();
+	size_t firstInstance[actorKinds + 1];
+	for (int kind = 0; kind < actorKinds; kind++)
+	{
+		firstInstance[kind] = instances.size();
+		if (!m_Shaders[kind]) continue;
+
+		for (int i = 0; i < m_Store->size(); i++)
+		{
+			if (m_Store->kind[i] != kind) continue;
+
+			float x = m_Store->getPosX(i), y = m_Store->getPosY(i);
+			if (x + 1.f < camera.getLeft() || x > camera.getRight() || y + 1.f < camera.getTop() || y > camera.getBottom())
+				continue;
+			instances.push_back({ { x, y }, (float)animators[kind]->getSprite(animations[i]) });
+		}
+	}
+	firstInstance[actorKinds] = instances.size();
+	if (instances.empty())
+		return;
+
+	//the buffer only grows, and is otherwise overwritten in place
+	if (instances.size() > instanceCapacity)
+	{
+		instanceCapacity = instances.size() * 2;
+		instanceVBO->updateBuffer(nullptr, (unsigned int)(instanceCapacity * sizeof(ActorInstance)));
+	}
+	instanceVBO->updateBufferRange(0, instances.data(), (unsigned int)(instances.size() * sizeof(ActorInstance)));
+
+	for (int kind = 0; kind < actorKinds; kind++)
+	{
+		unsigned int count = (unsigned int)(firstInstance[kind + 1] - firstInstance[kind]);
+		if (count == 0) continue;
+
+		Shader* shader = m_Shaders[kind];
+		shader->Bind();
+		shader->camera(camera);
+		animators[kind]->bind(0);
+		m_Renderer->DrawInstanced(quadVAO, quadIBO, shader, count, (unsigned int)firstInstance[kind]);
+	}
+}
@@ -0,0 +1,57 @@
+/**
+ * @file ActorRenderer.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the ActorRenderer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "ActorStore.h"
+#include "Animator.h"
+#include "Camera.h"
+#include "Renderer.h"
+#include "Shader.h"
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include "Vertex.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @class ActorRenderer
+ * @brief Draws the actors in an ActorStore. Every actor is drawn with the same one tile quad,
+ * 		  moved to the actor's position, and every kind of actor shares one shader and one array texture of sprites.
+ * 		  The visible actors are written to an instance buffer, the position and sprite of each, and every kind
+ * 		  is drawn with one instanced draw call, so neither texture slots nor draw calls grow with the amount of actors.
+ */
+class ActorRenderer
+{
+private:
+	ActorStore* m_Store;
+	Renderer*	m_Renderer;
+
+	Shader*		m_Shaders[actorKinds];
+	Animator*	animators[actorKinds];
+
+	std::vector <AnimationState> animations;	//one per actor
+
+	VertexArray*  quadVAO;
+	VertexBuffer* quadVBO;
+	IndexBuffer*  quadIBO;
+	VertexBuffer* instanceVBO;
+	std::vector <ActorInstance> instances;		//the visible actors, grouped by kind
+	size_t		  instanceCapacity;				//how many instances instanceVBO has room for
+public:
+	ActorRenderer(ActorStore* store, Renderer* renderer);
+	~ActorRenderer();
+
+	void setSprites(ActorKind kind, Shader* shader, const std::string& spritePaths);
+	void animate(float dt);
+	void reset();
+	void draw(const Camera& camera);
+};
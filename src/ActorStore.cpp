@@ -0,0 +1,100 @@
+/**
+ * @file ActorStore.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the ActorStore class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "ActorStore.h"
+
+/**
+ * @brief Construct a new Actor Store:: Actor Store object, without any actors.
+ *
+ */
+ActorStore::ActorStore()
+	: actorCount(0)
+{
+}
+
+/**
+ * @brief Adds an actor, standing still on a tile and facing right.
+ *
+ * @param kind 	- Pacman or a ghost
+ * @param mapID - The actor's value in the level file
+ * @param x 	- The horizontal tile
+ * @param y 	- The vertical tile
+ * @param speed - The speed, in tiles per second. It is rounded to whole tileUnits per tick.
+ * @return The index of the new actor
+ */
+int ActorStore::add(ActorKind kind, int mapID, int x, int y, float speed)
+{
+	tileX.push_back(x);
+	tileY.push_back(y);
+	offsetX.push_back(0);
+	offsetY.push_back(0);
+	direction.push_back(right);
+	nextDirection.push_back(right);
+	this->speed.push_back((int)(speed * tileUnits / ticksPerSecond + .5f));
+	enteredTile.push_back(1);	//so that a ghost decides where to go from its spawn
+	previousTile.push_back(-1);
+	alive.push_back(1);
+	this->kind.push_back(kind);
+	this->mapID.push_back(mapID);
+
+	return actorCount++;
+}
+
+/**
+ * @brief Adds an actor for every spawn in the maze, 2 is Pacman and 3 and up are ghosts.
+ * 		  The spawns come from the maze's spawn table, in the order of their tiles, and are replaced by 0 so that they get a pellet.
+ *
+ * @param maze 	- The maze holding the spawns
+ * @param speed - The speed of every actor, in tiles per second
+ */
+void ActorStore::spawnFromMaze(Maze* maze, float speed)
+{
+	const std::vector <MazeSpawn>& spawns = maze->getSpawns();
+	for (const MazeSpawn& spawn : spawns)
+	{
+		int x = spawn.tile % maze->getWidth(), y = spawn.tile / maze->getWidth();
+		if (maze->map2d[y][x] != spawn.code) continue;	//taken already, or changed since the level was loaded
+
+		add(spawn.code == 2 ? pacmanActor : ghostActor, spawn.code, x, y, speed);
+	}
+	maze->takeSpawns();
+}
+
+/**
+ * @brief Finds the first actor of a kind.
+ *
+ * @param kind - The kind of actor
+ * @return The index of the actor, or -1 if there is none
+ */
+int ActorStore::findByKind(ActorKind kind) const
+{
+	for (int i = 0; i < actorCount; i++)
+		if (this->kind[i] == kind)
+			return i;
+	return -1;
+}
+
+/**
+ * @brief Puts an actor back where it was spawned, moving as it did then. Whether it is alive does not change.
+ *
+ * @param actor  - The index of the actor
+ * @param spawns - The actors as they were spawned, with the same indices
+ */
+void ActorStore::respawn(int actor, const ActorStore& spawns)
+{
+	tileX[actor] = spawns.tileX[actor];
+	tileY[actor] = spawns.tileY[actor];
+	offsetX[actor] = spawns.offsetX[actor];
+	offsetY[actor] = spawns.offsetY[actor];
+	direction[actor] = spawns.direction[actor];
+	nextDirection[actor] = spawns.nextDirection[actor];
+	enteredTile[actor] = spawns.enteredTile[actor];
+	previousTile[actor] = -1;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file ActorStore.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the ActorStore class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+
+#include <vector>
+
+/**
+ * @brief What kind of actor it is, the ActorSystems update all actors of one kind together.
+ *
+ */
+enum ActorKind
+{
+	pacmanActor = 0,
+	ghostActor = 1,
+	actorKinds = 2
+};
+
+/**
+ * @class ActorStore
+ * @brief Holds the state of every actor (Pacman and the ghosts) in the maze.
+ * 		  Every property is stored in its own array, indexed by the actor, so that the
+ * 		  ActorSystems can update all actors in one pass over contiguous memory.
+ * 		  Drawing the actors is handled by the ActorRenderer.
+ *
+ * 		  Positions are in fixed point: the tile whose center is closest to the actor, and how far
+ * 		  the actor is from that center in tileUnits. An actor is always on the center line of its tile
+ * 		  on at least one axis, so at most one of the offsets is not 0.
+ */
+class ActorStore
+{
+private:
+	int actorCount;
+public:
+	static const int tileUnits = 256;		//fixed point units per tile
+	static const int ticksPerSecond = 128;	//the ActorSystems move the actors in fixed ticks
+
+	//kinematics
+	std::vector <int>		tileX,
+							tileY,
+							offsetX,	//-tileUnits / 2 to tileUnits / 2
+							offsetY;
+	std::vector <Direction> direction,
+							nextDirection;	//taken on the center of the next tile, when it can be
+	std::vector <int>		speed;			//tileUnits per tick
+	std::vector <char>		enteredTile;	//set when the actor has moved to a new tile, until it is handled
+	std::vector <int>		previousTile;	//the tile index before the last tick, -1 before the first
+	std::vector <char>		alive;
+	std::vector <ActorKind> kind;
+	std::vector <int>		mapID;		//the actor's value in the level file
+
+	ActorStore();
+
+	int  add(ActorKind kind, int mapID, int x, int y, float speed);
+	void spawnFromMaze(Maze* maze, float speed);
+	int  findByKind(ActorKind kind) const;
+	void respawn(int actor, const ActorStore& spawns);
+
+	int  size() const { return actorCount; }
+	float getPosX(int actor) const { return tileX[actor] + offsetX[actor] / (float)tileUnits; }	//in tiles, for drawing
+	float getPosY(int actor) const { return tileY[actor] + offsetY[actor] / (float)tileUnits; }
+};
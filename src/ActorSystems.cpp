@@ -0,0 +1,375 @@
+/**
+ * @file ActorSystems.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the ActorSystems class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "ActorSystems.h"
+
+/**
+ * @brief Construct a new Actor Systems:: Actor Systems object
+ *
+ * @param store - The actors that are updated
+ * @param maze 	- The maze the actors move in
+ * @param graph - The junction graph of the maze, where the ghosts make their decisions
+ */
+ActorSystems::ActorSystems(ActorStore* store, const Maze* maze, JunctionGraph* graph)
+	: m_Store(store),
+	  m_Maze(maze),
+	  m_Graph(graph),
+	  movementKernel(MovementKernel::getBest()),
+	  events(nullptr),
+	  chaseField(nullptr),
+	  chaseDistance(0),
+	  m_Pathfinder(nullptr),
+	  huntTarget(-1),
+	  planner(nullptr),
+	  ticks(0),
+	  tickTime(0)
+{
+	occupancy = new OccupancyGrid(m_Maze);
+}
+
+/**
+ * @brief Destroy the Actor Systems:: Actor Systems object
+ *
+ */
+ActorSystems::~ActorSystems()
+{
+	delete occupancy;
+	delete chaseField;
+	delete planner;
+}
+
+/**
+ * @brief Seeds the random choices of the ghosts, and drops the time that is not simulated yet.
+ * 		  The same seed and the same input always give the same game.
+ *
+ * @param seed - The seed
+ */
+void ActorSystems::seed(unsigned int seed)
+{
+	random.seed(seed);
+	tickTime = 0;
+	ticks = 0;
+	if (planner)
+		planner->clear();
+}
+
+/**
+ * @brief Changes the direction of an actor, used for the player's input.
+ *
+ * @param actor 	- The index of the actor
+ * @param direction - The new direction
+ */
+void ActorSystems::steer(int actor, Direction direction)
+{
+	m_Store->direction[actor] = m_Store->nextDirection[actor] = direction;
+}
+
+/**
+ * @brief Queues a turn, used by the autopilot and the environment library. Turning back is done at once,
+ * 		  any other turn is taken on the center of the tile, when the tile can be left that way.
+ *
+ * @param actor 	- The index of the actor
+ * @param direction - The direction to turn to
+ */
+void ActorSystems::turn(int actor, Direction direction)
+{
+	if (direction == opposite(m_Store->direction[actor]))
+		m_Store->direction[actor] = direction;
+	m_Store->nextDirection[actor] = direction;
+}
+
+/**
+ * @brief Takes over the random state and the time that is not simulated yet from the systems of another copy of the same game.
+ *
+ * @param other - The systems that are copied
+ */
+void ActorSystems::copyState(const ActorSystems& other)
+{
+	random = other.random;
+	tickTime = other.tickTime;
+	movementKernel = other.movementKernel;
+	setChaseDistance(other.chaseDistance);
+	if (chaseField && other.chaseField)	//the field of the copy is as good as a new search
+	{
+		chaseField->copyFrom(*other.chaseField);
+		chaseSources = other.chaseSources;
+	}
+	setCooperative(other.planner != nullptr);
+	if (planner)
+		planner->copyState(*other.planner);
+	ticks = other.ticks;
+}
+
+/**
+ * @brief Runs as many ticks as fit in the time that has passed.
+ * 		  After a long stall at most maxTicksPerUpdate ticks are run, and the rest of the time is dropped.
+ *
+ * @param dt - Delta time (time elapsed since the last iteration)
+ */
+void ActorSystems::update(float dt)
+{
+	const double tickLength = 1.0 / ActorStore::ticksPerSecond;
+	tickTime += dt;
+	for (int run = 0; tickTime >= tickLength; run++)
+	{
+		if (run == maxTicksPerUpdate)
+		{
+			tickTime = 0;
+			break;
+		}
+		tick();
+		tickTime -= tickLength;
+	}
+}
+
+/**
+ * @brief Runs every system once: the ghosts decide where to go, everyone moves and then Pacman is caught
+ * 		  by the ghosts it has met.
+ *
+ */
+void ActorSystems::tick()
+{
+	decideGhosts();
+	move();
+	checkCollisions();
+	ticks++;
+}
+
+/**
+ * @brief Lets the ghosts that have moved to a new tile pick the direction they take on its center.
+ * 		  On a node of the junction graph the ghost picks a random corridor, but does not turn back unless it is
+ * 		  a dead end. Between the nodes the ghost follows the corridor around its corners.
+ * 		  When the ghosts chase (see setChaseDistance()), a ghost close enough to Pacman takes the corridor towards Pacman instead,
+ * 		  or the corridor its plan takes when the ghosts chase together (see setCooperative()).
+ * 		  With a HierarchicalPathfinder (see setPathfinder()) the other ghosts hunt Pacman from anywhere in the maze.
+ *
+ */
+void ActorSystems::decideGhosts()
+{
+	ActorStore& store = *m_Store;
+	if (chaseDistance > 0)
+		updateChaseField();
+	if (chaseDistance > 0 && planner)
+		planner->beginTick(ticks, store.size());
+	if (m_Pathfinder)
+	{
+		huntTarget = -1;
+		for (int i = 0; i < store.size() && huntTarget == -1; i++)
+			if (store.kind[i] == pacmanActor && store.alive[i])
+				huntTarget = m_Maze->getTileIndex(store.tileX[i], store.tileY[i]);
+		ghostPaths.resize(store.size());
+	}
+	for (int i = 0; i < store.size(); i++)
+	{
+		if (store.kind[i] != ghostActor || !store.enteredTile[i]) continue;
+		store.enteredTile[i] = 0;
+
+		int tile = m_Maze->getTileIndex(store.tileX[i], store.tileY[i]);
+		int exits = m_Maze->getExits(tile) & ~(1 << opposite(store.direction[i]));
+		if (exits == 0)
+		{
+			store.nextDirection[i] = opposite(store.direction[i]);
+			continue;
+		}
+
+		int node = m_Graph->getNodeOfTile(tile);
+		if (node != -1 && chaseDistance > 0)
+		{
+			int chase = planner ? planner->decide(i, tile, exits, ticks, store.speed[i], *chaseField) : -1;
+			if (chase == -1)
+				chase = chooseChase(tile, exits);
+			if (chase != -1)
+			{
+				store.nextDirection[i] = (Direction)chase;
+				continue;
+			}
+		}
+		if (node != -1 && m_Pathfinder && huntTarget != -1)
+		{
+			int hunt = chooseHunt(i, tile, exits);
+			if (hunt != -1)
+			{
+				store.nextDirection[i] = (Direction)hunt;
+				continue;
+			}
+		}
+
+		int choices[4], choiceCount = 0;
+		for (int d = 0; d < 4; d++)
+			if (exits >> d & 1)
+				choices[choiceCount++] = d;
+
+		store.nextDirection[i] = (Direction)choices[node == -1 ? 0 : random() % choiceCount];
+	}
+}
+
+/**
+ * @brief Lets the ghosts chase Pacman when Pacman is close. The distances to every living Pacman are found with a DistanceField,
+ * 		  up to the chase distance, and only when a Pacman has moved to a new tile, so chasing costs the same on any size of maze.
+ *
+ * @param tiles - How close a ghost has to be, in steps through the maze, 0 to stop chasing
+ */
+void ActorSystems::setChaseDistance(int tiles)
+{
+	chaseDistance = tiles > 0 ? tiles : 0;
+	chaseSources.clear();	//found again on the next decision
+	if (chaseDistance > 0 && !chaseField)
+		chaseField = new DistanceField(m_Maze);
+}
+
+/**
+ * @brief Lets the chasing ghosts plan their way together with a CooperativePlanner, so that they close in on Pacman from
+ * 		  different corridors instead of following each other. Only has an effect when the ghosts chase (see setChaseDistance()).
+ *
+ * @param cooperative - true to plan together, false to let every ghost chase on its own
+ */
+void ActorSystems::setCooperative(bool cooperative)
+{
+	if (cooperative && !planner)
+		planner = new CooperativePlanner(m_Maze, m_Graph);
+	else if (!cooperative && planner)
+	{
+		delete planner;
+		planner = nullptr;
+	}
+}
+
+/**
+ * @brief Finds the distances to the Pac-Men again, if any of them is on another tile than the last time.
+ *
+ */
+void ActorSystems::updateChaseField()
+{
+	const ActorStore& store = *m_Store;
+	pacmanTiles.clear();
+	for (int i = 0; i < store.size(); i++)
+		if (store.kind[i] == pacmanActor && store.alive[i])
+			pacmanTiles.push_back(m_Maze->getTileIndex(store.tileX[i], store.tileY[i]));
+
+	if (pacmanTiles == chaseSources)
+		return;
+	chaseSources.swap(pacmanTiles);
+	chaseField->compute(chaseSources, chaseDistance);
+}
+
+/**
+ * @brief Picks the exit of a tile that leads closest to a Pacman.
+ *
+ * @param tile 	- The tile index of the ghost
+ * @param exits - The directions the ghost may take, one bit per direction
+ * @return The direction, -1 if no Pacman is within the chase distance
+ */
+int ActorSystems::chooseChase(int tile, int exits) const
+{
+	int best = -1, bestDistance = 0;
+	for (int d = 0; d < 4; d++)
+	{
+		if (!(exits >> d & 1)) continue;
+		int distance = chaseField->getDistance(m_Maze->getNeighbour(tile, (Direction)d));
+		if (distance != -1 && (best == -1 || distance < bestDistance))
+		{
+			best = d;
+			bestDistance = distance;
+		}
+	}
+	return best;
+}
+
+/**
+ * @brief Picks the exit of a tile that follows the ghost's path to Pacman. The path is only found again when the ghost
+ * 		  has left it, has reached its end, or Pacman has moved to another cluster of the HierarchicalPathfinder.
+ *
+ * @param ghost - The index of the ghost
+ * @param tile 	- The tile index of the ghost
+ * @param exits - The directions the ghost may take, one bit per direction
+ * @return The direction, -1 if there is no path or it turns back
+ */
+int ActorSystems::chooseHunt(int ghost, int tile, int exits)
+{
+	HierarchicalPath& path = ghostPaths[ghost];
+	bool stale = path.goal == -1 || path.isDone() ||
+				 m_Pathfinder->getClusterOfTile(path.goal) != m_Pathfinder->getClusterOfTile(huntTarget);
+	int next = stale ? -1 : m_Pathfinder->nextTile(path, tile);
+	if (next == -1)
+	{
+		if (!m_Pathfinder->findPath(tile, huntTarget, path))
+			return -1;
+		next = m_Pathfinder->nextTile(path, tile);
+	}
+
+	for (int d = 0; d < 4; d++)
+		if ((exits >> d & 1) && m_Maze->getNeighbour(tile, (Direction)d) == next)
+			return d;
+	return -1;
+}
+
+/**
+ * @brief Moves every living actor one tick in its direction, using the exits of the tiles instead of looking at the walls.
+ * 		  On the center of a tile the actor turns to its next direction, if the tile can be left that way.
+ * 		  An actor stops on the center of a tile it can not leave in its direction, and "snaps" to the center line
+ * 		  of its tile on the other axis. The actor moves to the next tile exactly when it passes the edge between them,
+ * 		  which for a tunnel is on the opposite side of the maze.
+ * 		  The work is done by the fastest MovementKernel the CPU supports, unless another one has been set.
+ *
+ */
+void ActorSystems::move()
+{
+	ActorStore& store = *m_Store;
+	MovementBatch batch;
+	batch.tileX			= store.tileX.data();
+	batch.tileY			= store.tileY.data();
+	batch.offsetX		= store.offsetX.data();
+	batch.offsetY		= store.offsetY.data();
+	batch.direction		= store.direction.data();
+	batch.nextDirection = store.nextDirection.data();
+	batch.speed			= store.speed.data();
+	batch.alive			= store.alive.data();
+	batch.enteredTile	= store.enteredTile.data();
+	batch.previousTile	= store.previousTile.data();
+	batch.count			= store.size();
+	batch.exits			= m_Maze->getExitTable();
+	batch.width			= m_Maze->getWidth();
+	batch.height		= m_Maze->getHeight();
+
+	MovementKernel::run(movementKernel, batch);
+}
+
+/**
+ * @brief Kills every Pacman that is on the same tile as a ghost, or has swapped tiles with a ghost during the last tick,
+ * 		  and sends a pacmanCaught event for it.
+ * 		  The actors are put on the OccupancyGrid first, so only the ghosts on Pacman's tiles are looked at.
+ *
+ */
+void ActorSystems::checkCollisions()
+{
+	ActorStore& store = *m_Store;
+	occupancy->build(store);
+
+	for (int player = 0; player < store.size(); player++)
+	{
+		if (store.kind[player] != pacmanActor || !store.alive[player]) continue;
+
+		int tile = m_Maze->getTileIndex(store.tileX[player], store.tileY[player]);
+		bool caught = false;
+		for (int ghost = occupancy->getFirst(tile); ghost != -1; ghost = occupancy->getNext(ghost))
+			if (store.kind[ghost] == ghostActor)
+				caught = true;
+
+		int previous = store.previousTile[player];
+		if (previous != -1 && previous != tile)
+			for (int ghost = occupancy->getFirst(previous); ghost != -1; ghost = occupancy->getNext(ghost))
+				if (store.kind[ghost] == ghostActor && store.previousTile[ghost] == tile)
+					caught = true;
+
+		if (!caught) continue;
+		store.alive[player] = 0;
+		if (events) events->push({ pacmanCaught, player, tile });
+	}
+}
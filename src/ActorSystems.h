@@ -0,0 +1,83 @@
+/**
+ * @file ActorSystems.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the ActorSystems class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "ActorStore.h"
+#include "JunctionGraph.h"
+#include "Maze.h"
+#include "OccupancyGrid.h"
+#include "MovementKernel.h"
+#include "GameEvents.h"
+#include "DistanceField.h"
+#include "HierarchicalPathfinder.h"
+#include "CooperativePlanner.h"
+
+#include <random>
+
+/**
+ * @class ActorSystems
+ * @brief Updates the actors in the ActorStore. Every system is one loop over all actors (of one kind),
+ * 		  so that thousands of actors can be simulated every frame.
+ * 		  The actors are moved in fixed ticks, using only integer math, so the same ticks always give the same result.
+ */
+class ActorSystems
+{
+private:
+	ActorStore* m_Store;
+	const Maze*	m_Maze;
+	JunctionGraph* m_Graph;
+	OccupancyGrid* occupancy;
+	MovementKernelType movementKernel;
+	std::minstd_rand random;		//the ghosts' choices, seeded so that a game can be replayed
+	GameEventRing* events;			//where Pacman being caught is sent, if anywhere
+	DistanceField* chaseField;		//the distance to the nearest Pacman, nullptr until the ghosts chase
+	int			chaseDistance;		//how close a ghost has to be to chase Pacman, 0 when the ghosts do not chase
+	std::vector <int> chaseSources,	//the tiles of the Pac-Men the chase field was found for
+					  pacmanTiles;
+	HierarchicalPathfinder* m_Pathfinder;	//for the ghosts that hunt Pacman from far away, nullptr if they do not
+	std::vector <HierarchicalPath> ghostPaths;
+	int			huntTarget;			//the tile the hunting ghosts go to, -1 for none
+	CooperativePlanner* planner;	//spreads the chasing ghosts out, nullptr if they chase on their own
+	long long	ticks;				//since the systems were seeded, the time of the planner's reservations
+
+	double		tickTime;		//time that has passed, but is not simulated yet
+public:
+	static const int maxTicksPerUpdate = 32;
+
+	ActorSystems(ActorStore* store, const Maze* maze, JunctionGraph* graph);
+	~ActorSystems();
+
+	void seed(unsigned int seed);
+	void steer(int actor, Direction direction);
+	void turn(int actor, Direction direction);
+	void copyState(const ActorSystems& other);
+	void update(float dt);
+	void tick();
+
+	void decideGhosts();
+	void move();
+	void checkCollisions();
+
+	JunctionGraph* getGraph() const { return m_Graph; }
+	const OccupancyGrid& getOccupancy() const { return *occupancy; }
+	void setMovementKernel(MovementKernelType type) { movementKernel = type; }
+	void setEventRing(GameEventRing* ring) { events = ring; }
+	void setChaseDistance(int tiles);
+	int getChaseDistance() const { return chaseDistance; }
+	void invalidateChaseField() { chaseSources.clear(); }	//found again on the next decision, after tiles have changed
+	void setPathfinder(HierarchicalPathfinder* pathfinder) { m_Pathfinder = pathfinder; }
+	void setCooperative(bool cooperative);
+	bool isCooperative() const { return planner != nullptr; }
+
+private:
+	void updateChaseField();
+	int  chooseChase(int tile, int exits) const;
+	int  chooseHunt(int ghost, int tile, int exits);
+};
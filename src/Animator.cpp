@@ -19,6 +19,7 @@
  * @param filepaths - link to the file containing the paths to the actual images
  */
 Animator::Animator(std::string filepaths)
+	: sprites(nullptr)
 {
 	std::ifstream spriteLocations(filepaths);
 
@@ -31,9 +32,7 @@ Animator::Animator(std::string filepaths)
 		spritePaths.push_back(path);
 	}
 	generateTextures();
-	animationTime = 0;
 	spritesPerDirection = spriteCount / 4;
-	startIndex = endIndex = index = 0;
 }
 
 /**
@@ -42,48 +41,49 @@ Animator::Animator(std::string filepaths)
  */
 Animator::~Animator()
 {
-	for (int i = 0; i < textures.size(); i++)
-	{
-		free(textures[i]);
-	}
+	delete sprites;
 }
 
 /**
- * @brief Generates a new texture for every filepath saved in the spritePaths vector.
+ * @brief Generates the array texture holding the sprites, one layer for every filepath saved in the spritePaths vector.
  * 
  */
 void Animator::generateTextures()
 {
-	for (int i = 0; i < spriteCount; i++)
-		textures.push_back(new Texture(spritePaths[i])); 
+	delete sprites;
+	sprites = new Texture(spritePaths);
 }
 
 /**
- * @brief - Animates the MovableObject to which the animator is attached to.
+ * @brief - Animates an actor, showing the next sprite for its direction every 0.07 seconds.
  * 
- * @param direction 	- The direction the object is currently moving
+ * @param state 		- The actor's animation
+ * @param direction 	- The direction the actor is currently moving
  * @param dt 			- Delta time (time elapsed since last iteration of the loop)
- * @param mapID 		- What identifier this MovableObject has in the level
- * @param newDirection  - Wheter or not the object has changed its moving direction
  */
-void Animator::animate(const int direction, const float dt, const int mapID, bool& newDirection)
+void Animator::animate(AnimationState& state, const int direction, const float dt) const
 {
-	if (newDirection)
+	if (direction != state.direction)	//starts over on the sprites of the new direction
 	{
-		newDirection = false;
-		startIndex	 = spritesPerDirection * direction;
-		endIndex	 = startIndex + spritesPerDirection;
-		index		 = startIndex;
+		state.direction		= direction;
+		state.frame			= 0;
+		state.animationTime = 0;
 	}
 
-	animationTime += dt;
-	if (animationTime >= 0.07 && index < endIndex)
+	state.animationTime += dt;
+	if (state.animationTime >= 0.07)
 	{
-		textures[index]->Bind(mapID);
-		index++;
-		animationTime = 0;
+		state.frame = (state.frame + 1) % spritesPerDirection;
+		state.animationTime = 0;
 	}
-	if (index >= endIndex) index = startIndex;
 }
 
-
+/**
+ * @brief Binds the sprites, every actor picks its own layer (see getSprite()).
+ * 
+ * @param slot 	- The texture slot to bind them to
+ */
+void Animator::bind(unsigned int slot) const
+{
+	sprites->Bind(slot);
+}
@@ -13,9 +13,22 @@
 #include "Texture.h"
 #include <vector>
 
+/**
+ * @brief How far an actor has come in its animation, one per actor.
+ * 
+ */
+struct AnimationState
+{
+	int		direction = 0,
+			frame	  = 0;
+	double	animationTime = 0;
+};
+
 /**
  * @class Animator
- * @brief Class handling everything regarding the animation of the MovableObjects
+ * @brief Class handling everything regarding the animation of the actors.
+ * 		  The sprites are shared by every actor of a kind, as the layers of one array texture,
+ * 		  and each actor has its own AnimationState, which picks the layer it is drawn with.
  */
 class Animator
 {
@@ -23,14 +36,13 @@ private:
 	std::vector <std::string> spritePaths;
 
 	int spriteCount;
-	double animationTime;
-
-	int startIndex, endIndex, index;
 	int spritesPerDirection;
 public:
-	std::vector <Texture*> textures;
+	Texture* sprites;
 	Animator(std::string filepaths);
 	~Animator();
 	void generateTextures();
-	void animate(const int direction, const float dt, const int mapID, bool& newDirection);
+	void animate(AnimationState& state, const int direction, const float dt) const;
+	int  getSprite(const AnimationState& state) const { return spritesPerDirection * state.direction + state.frame; }
+	void bind(unsigned int slot) const;
 };
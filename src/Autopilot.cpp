@@ -0,0 +1,239 @@
+/**
+ * @file Autopilot.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the Autopilot class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Autopilot.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Construct a new Autopilot:: Autopilot object, and starts its threads. They wait for the decisions.
+ *
+ * @param game 	   - A game of the level that is played, every thread gets a copy of it to search with
+ * @param settings - How the Autopilot searches
+ */
+Autopilot::Autopilot(const GameState& game, const AutopilotSettings& settings)
+	: settings(settings),
+	  root(nullptr),
+	  decisions(0),
+	  searching(0),
+	  quitting(false),
+	  rollouts(0)
+{
+	int threadCount = settings.threads > 0 ? settings.threads : std::max((int)std::thread::hardware_concurrency(), 1);
+	for (int i = 0; i < threadCount; i++)
+	{
+		Worker* worker = new Worker;
+		worker->game = new GameState(game);
+		worker->random.seed(i + 1);
+		worker->rollouts = 0;
+		workers.push_back(worker);
+	}
+	for (int i = 0; i < threadCount; i++)
+		threads.emplace_back(&Autopilot::work, this, i);
+}
+
+/**
+ * @brief Destroy the Autopilot:: Autopilot object, after its threads have stopped.
+ *
+ */
+Autopilot::~Autopilot()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quitting = true;
+	}
+	started.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (Worker* worker : workers)
+	{
+		delete worker->game;
+		delete worker;
+	}
+}
+
+/**
+ * @brief Searches for Pacman's next action, using every thread for the time budget.
+ * 		  The action is meant to be taken with ActorSystems::turn(), when Pacman has moved to a new tile.
+ *
+ * @param game - The game as it is now, it must not change until the decision is made
+ * @return The direction to turn to
+ */
+Direction Autopilot::decide(const GameState& game)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		root = &game;
+		deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+													   std::chrono::duration<float>(settings.budget));
+		searching = (int)workers.size();
+		decisions++;
+	}
+	started.notify_all();
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		finished.wait(lock, [&]() { return searching == 0; });
+	}
+
+	//the action tried the most, over every tree
+	long long visits[4] = { 0, 0, 0, 0 };
+	rollouts = 0;
+	for (Worker* worker : workers)
+	{
+		for (int action = 0; action < 4; action++)
+		{
+			int child = worker->tree[0].children[action];
+			if (child != -1) visits[action] += worker->tree[child].visits;
+		}
+		rollouts += worker->rollouts;
+	}
+
+	int best = game.getActors().direction[game.getPlayer()];
+	for (int action = 0; action < 4; action++)
+		if (visits[action] > visits[best])
+			best = action;
+	return (Direction)best;
+}
+
+/**
+ * @brief The loop of a thread: waits for a decision, and searches until the time is up.
+ *
+ * @param worker - The index of the thread's worker
+ */
+void Autopilot::work(int worker)
+{
+	unsigned int decision = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			started.wait(lock, [&]() { return quitting || decisions != decision; });
+			if (quitting) return;
+			decision = decisions;
+		}
+
+		Worker& self = *workers[worker];
+		self.tree.clear();
+		self.tree.push_back({ { -1, -1, -1, -1 }, 0, 0.0 });
+		self.rollouts = 0;
+		do
+			searchOnce(self);
+		while (std::chrono::steady_clock::now() < deadline);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--searching == 0)
+				finished.notify_one();
+		}
+	}
+}
+
+/**
+ * @brief One search from the root: follows the tree by the upper confidence bound of the actions, tries a new action
+ * 		  when a node has one left, plays random actions from there, and adds the value of the game to every node on the way.
+ *
+ * @param worker - The worker searching
+ */
+void Autopilot::searchOnce(Worker& worker)
+{
+	GameState& game = *worker.game;
+	game = *root;
+	game.reseed(worker.random());	//the ghosts take other turns in every search
+
+	std::vector <SearchNode>& tree = worker.tree;
+	worker.path.clear();
+	worker.path.push_back(0);
+
+	int node = 0, actions = 0, eaten = 0;
+	while (!game.isOver())
+	{
+		int untried[4], untriedCount = 0;
+		for (int action = 0; action < 4; action++)
+			if (tree[node].children[action] == -1)
+				untried[untriedCount++] = action;
+
+		if (untriedCount)
+		{
+			int action = untried[worker.random() % untriedCount];
+			int child = (int)tree.size();
+			tree.push_back({ { -1, -1, -1, -1 }, 0, 0.0 });
+			tree[node].children[action] = child;
+
+			eaten += game.step(action, settings.ticksPerAction);
+			actions++;
+			worker.path.push_back(child);
+			break;
+		}
+
+		int best = 0;
+		double bestScore = -1.0, logVisits = std::log((double)tree[node].visits);
+		for (int action = 0; action < 4; action++)
+		{
+			const SearchNode& child = tree[tree[node].children[action]];
+			double score = child.value / child.visits + settings.exploration * std::sqrt(logVisits / child.visits);
+			if (score > bestScore)
+			{
+				bestScore = score;
+				best = action;
+			}
+		}
+
+		eaten += game.step(best, settings.ticksPerAction);
+		actions++;
+		node = tree[node].children[best];
+		worker.path.push_back(node);
+	}
+
+	for (int i = 0; i < settings.rolloutActions && !game.isOver(); i++)
+	{
+		eaten += game.step(randomAction(worker), settings.ticksPerAction);
+		actions++;
+	}
+
+	double value = 0.0;
+	if (game.isCleared())
+		value = 1.0;
+	else if (game.getActors().alive[game.getPlayer()])
+		value = .5 + .5 * std::min(actions ? (double)eaten / actions : 0.0, 1.0);	//at most a pellet per tile
+
+	for (int visited : worker.path)
+	{
+		tree[visited].visits++;
+		tree[visited].value += value;
+	}
+	worker.rollouts++;
+}
+
+/**
+ * @brief A random action for the end of a search: one of the ways out of Pacman's tile, but not back unless it is a dead end.
+ *
+ * @param worker - The worker searching
+ * @return The direction
+ */
+int Autopilot::randomAction(Worker& worker) const
+{
+	const GameState& game = *worker.game;
+	const ActorStore& actors = game.getActors();
+	int player = game.getPlayer();
+	Direction direction = actors.direction[player];
+
+	int tile = game.getMaze().getTileIndex(actors.tileX[player], actors.tileY[player]);
+	int exits = game.getMaze().getExits(tile) & ~(1 << opposite(direction));
+	if (exits == 0)
+		return opposite(direction);
+
+	int choices[4], choiceCount = 0;
+	for (int d = 0; d < 4; d++)
+		if (exits >> d & 1)
+			choices[choiceCount++] = d;
+	return choices[worker.random() % choiceCount];
+}
@@ -0,0 +1,86 @@
+/**
+ * @file Autopilot.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the Autopilot class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "GameState.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief How the Autopilot searches.
+ *
+ */
+struct AutopilotSettings
+{
+	int	  threads = 0;				//0 for one per hardware thread
+	float budget = .01f;			//the time every decision may take, in seconds
+	int	  ticksPerAction = 32;		//how long an action in the search lasts, one tile at 4 tiles per second
+	int	  rolloutActions = 8;		//the random actions after the search tree
+	float exploration = 1.4f;		//how much the search tries the actions that look bad
+};
+
+/**
+ * @class Autopilot
+ * @brief Plays Pacman by itself, for demos and for benchmarking levels. Every decision is a Monte Carlo tree search over
+ * 		  copies of the game: the tree holds Pacman's actions, and every search from the root plays the game forward with
+ * 		  randomly seeded ghosts, ending with random actions. A game is worth 0 if Pacman is caught, otherwise more the more pellets are eaten.
+ * 		  Every thread of the pool searches its own tree from the same game until the time is up (root parallel search),
+ * 		  and the action that was searched the most over all trees is taken.
+ */
+class Autopilot
+{
+private:
+	struct SearchNode
+	{
+		int	   children[4];	//per action, -1 until it has been tried
+		int	   visits;
+		double value;
+	};
+
+	struct Worker
+	{
+		std::vector <SearchNode> tree;
+		std::vector <int>		 path;
+		GameState*				 game;		//the copy the search plays forward
+		std::minstd_rand		 random;
+		long long				 rollouts;
+	};
+
+	AutopilotSettings		  settings;
+	std::vector <Worker*>	  workers;
+	std::vector <std::thread> threads;
+
+	std::mutex				  mutex;
+	std::condition_variable	  started,
+							  finished;
+	const GameState*		  root;
+	std::chrono::steady_clock::time_point deadline;
+	unsigned int			  decisions;	//counts the decisions, a new value starts the workers
+	int						  searching;	//the workers that have not finished the decision
+	bool					  quitting;
+	long long				  rollouts;		//during the last decision
+public:
+	Autopilot(const GameState& game, const AutopilotSettings& settings = AutopilotSettings());
+	~Autopilot();
+
+	Direction decide(const GameState& game);
+	long long getRollouts() const { return rollouts; }
+	int getThreads() const { return (int)threads.size(); }
+
+private:
+	void work(int worker);
+	void searchOnce(Worker& worker);
+	int  randomAction(Worker& worker) const;
+};
@@ -0,0 +1,80 @@
+/**
+ * @file Camera.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the Camera class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Camera.h"
+
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+
+/**
+ * @brief Construct a new Camera:: Camera object, centered on the maze.
+ *
+ * @param mazeWidth  - The width of the maze
+ * @param mazeHeight - The height of the maze
+ * @param viewWidth  - The amount of tiles that are visible horizontally, when not zoomed
+ * @param viewHeight - The amount of tiles that are visible vertically, when not zoomed
+ */
+Camera::Camera(int mazeWidth, int mazeHeight, float viewWidth, float viewHeight)
+	: mazeWidth(mazeWidth),
+	  mazeHeight(mazeHeight),
+	  viewWidth(viewWidth),
+	  viewHeight(viewHeight),
+	  centerX(mazeWidth / 2.f),
+	  centerY(mazeHeight / 2.f),
+	  zoomFactor(1.f)
+{
+	clamp();
+}
+
+/**
+ * @brief Centers the camera on a position in the maze.
+ *
+ * @param x - The horizontal position, in tiles
+ * @param y - The vertical position, in tiles
+ */
+void Camera::follow(float x, float y)
+{
+	centerX = x; centerY = y;
+	clamp();
+}
+
+/**
+ * @brief Zooms in (factor > 1) or out (factor < 1). Can not zoom out further than the whole maze.
+ *
+ * @param factor - How much to zoom
+ */
+void Camera::zoom(float factor)
+{
+	float maxOut = std::min(viewWidth / mazeWidth, viewHeight / mazeHeight);
+	zoomFactor = std::min(std::max(zoomFactor * factor, std::min(maxOut, 1.f)), 16.f);
+	clamp();
+}
+
+/**
+ * @brief Makes the orthographic projection for the visible area.
+ *
+ * @return The projection matrix, with y pointing down as in the level files
+ */
+glm::mat4 Camera::getProjection() const
+{
+	return glm::ortho(getLeft(), getRight(), getBottom(), getTop());
+}
+
+/**
+ * @brief Keeps the visible area inside the maze, or centered if the maze is smaller than the visible area.
+ *
+ */
+void Camera::clamp()
+{
+	float halfWidth = getVisibleWidth() / 2.f, halfHeight = getVisibleHeight() / 2.f;
+
+	centerX = (2.f * halfWidth >= mazeWidth)   ? mazeWidth / 2.f  : std::min(std::max(centerX, halfWidth), mazeWidth - halfWidth);
+	centerY = (2.f * halfHeight >= mazeHeight) ? mazeHeight / 2.f : std::min(std::max(centerY, halfHeight), mazeHeight - halfHeight);
+}
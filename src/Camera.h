@@ -0,0 +1,45 @@
+/**
+ * @file Camera.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the Camera class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <glm/glm.hpp>
+
+/**
+ * @class Camera
+ * @brief Decides which part of the maze is visible. The area is measured in tiles,
+ * 		  and is kept inside the maze when it is smaller than the maze.
+ */
+class Camera
+{
+private:
+	int		mazeWidth,
+			mazeHeight;
+	float	viewWidth,
+			viewHeight,
+			centerX,
+			centerY,
+			zoomFactor;
+public:
+	Camera(int mazeWidth, int mazeHeight, float viewWidth, float viewHeight);
+
+	void follow(float x, float y);
+	void zoom(float factor);
+
+	float getLeft() const	{ return centerX - getVisibleWidth() / 2.f; }
+	float getRight() const	{ return centerX + getVisibleWidth() / 2.f; }
+	float getTop() const	{ return centerY - getVisibleHeight() / 2.f; }
+	float getBottom() const { return centerY + getVisibleHeight() / 2.f; }
+	float getVisibleWidth() const	{ return viewWidth / zoomFactor; }
+	float getVisibleHeight() const	{ return viewHeight / zoomFactor; }
+	glm::mat4 getProjection() const;
+
+private:
+	void clamp();
+};
@@ -0,0 +1,362 @@
+/**
+ * @file Campaign.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the CampaignLevel struct and the Campaign class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Campaign.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @brief Destroy the Campaign Level:: Campaign Level object, and everything made for it
+ *
+ */
+CampaignLevel::~CampaignLevel()
+{
+	delete camera;
+	delete pellets;
+	delete mazeRenderer;
+	delete systems;
+	delete pathfinder;
+	delete junctionGraph;
+	delete maze;
+	delete scenario;
+}
+
+/**
+ * @brief Changes a tile of the level while it is played, and updates only what depends on that tile:
+ * 		  the exits around it, the corridors through it, the mesh of its chunk and its pellet.
+ * 
+ * @param x 	- The horizontal tile
+ * @param y 	- The vertical tile
+ * @param value - 1 for a wall, 0 for a pellet, 9 for an empty corridor
+ * @return true if the tile changed
+ */
+bool CampaignLevel::setTile(int x, int y, int value)
+{
+	bool wasWall = maze->map2d[y][x] == 1,
+		 hadPellet = maze->hasPellet(x, y);
+	if (!maze->setTile(x, y, value))
+		return false;
+
+	if (wasWall != (value == 1))
+	{
+		junctionGraph->updateTile(maze->getTileIndex(x, y));
+		systems->invalidateChaseField();
+		if (pathfinder)
+			pathfinder->updateTile(maze->getTileIndex(x, y));
+	}
+	if (wasWall != (value == 1) || hadPellet != maze->hasPellet(x, y))
+		mazeRenderer->updateTile(x, y);
+	pellets->updateTile(x, y, hadPellet);
+	return true;
+}
+
+/**
+ * @brief Puts the actors that are inside a wall, or moving into one, back on their spawns,
+ * 		  after tiles have been changed. The other actors keep going where they are.
+ * 
+ * @param actors - The actors of the game
+ * @return The amount of actors that were moved
+ */
+int CampaignLevel::respawnBlockedActors(ActorStore* actors) const
+{
+	int moved = 0;
+	for (int i = 0; i < actors->size(); i++)
+	{
+		int tile = maze->getTileIndex(actors->tileX[i], actors->tileY[i]);
+		bool blocked = !maze->isWalkable(tile) ||
+					   (actors->offsetX[i] > 0 && !maze->canLeave(tile, right)) || (actors->offsetX[i] < 0 && !maze->canLeave(tile, left)) ||
+					   (actors->offsetY[i] > 0 && !maze->canLeave(tile, down))  || (actors->offsetY[i] < 0 && !maze->canLeave(tile, up));
+		if (blocked)
+		{
+			actors->respawn(i, spawns);
+			moved++;
+		}
+	}
+	return moved;
+}
+
+/**
+ * @brief Construct a new Campaign:: Campaign object, without any levels.
+ *
+ * @param mazeShader 	- The shader of the maze, shared by every level
+ * @param pelletsShader - The shader of the pellets, shared by every level
+ * @param renderer 		- The renderer used for drawing
+ * @param actors 		- The actors of the game, every level is played with them
+ */
+Campaign::Campaign(Shader* mazeShader, Shader* pelletsShader, Renderer* renderer, ActorStore* actors)
+	: nextEntry(0),
+	  m_MazeShader(mazeShader),
+	  m_PelletsShader(pelletsShader),
+	  m_Renderer(renderer),
+	  m_Actors(actors),
+	  hunting(false),
+	  nextReady(false),
+	  next(nullptr)
+{
+}
+
+/**
+ * @brief Destroy the Campaign:: Campaign object, after the worker has finished the level it was loading.
+ *
+ */
+Campaign::~Campaign()
+{
+	if (worker.joinable())
+		worker.join();
+	delete next;
+}
+
+/**
+ * @brief Adds the levels of a manifest, or of a directory.
+ *
+ * @param path - The manifest, or the directory
+ * @return true if any level was added
+ */
+bool Campaign::load(const std::string& path)
+{
+	std::error_code error;
+	if (std::filesystem::is_directory(path, error))
+		return loadDirectory(path);
+	return loadManifest(path);
+}
+
+/**
+ * @brief Adds a level file to the end of the campaign.
+ *
+ * @param path - The level file
+ */
+void Campaign::addLevel(const std::string& path)
+{
+	entries.push_back({ path, MazeGeneratorSettings() });
+}
+
+/**
+ * @brief Adds a generated level to the end of the campaign, it is generated when it is loaded.
+ *
+ * @param settings - The settings of the MazeGenerator
+ */
+void Campaign::addLevel(const MazeGeneratorSettings& settings)
+{
+	entries.push_back({ std::string(), settings });
+}
+
+/**
+ * @brief Adds the levels of a manifest. Every line is a level file, or "generate WxH [seed] [ghosts]" for a generated level.
+ * 		  Empty lines and lines starting with # are skipped.
+ *
+ * @param path - The manifest
+ * @return true if any level was added
+ */
+bool Campaign::loadManifest(const std::string& path)
+{
+	std::ifstream manifest(path);
+	if (!manifest)
+	{
+		std::cout << "Warning: Could not open the campaign " << path << '\n';
+		return false;
+	}
+
+	size_t added = 0;
+	std::string line;
+	while (std::getline(manifest, line))
+	{
+		std::istringstream words(line);
+		std::string first;
+		if (!(words >> first) || first[0] == '#')
+			continue;
+
+		if (first == "generate")
+		{
+			MazeGeneratorSettings settings;
+			std::string size;
+			if (!(words >> size) || sscanf(size.c_str(), "%dx%d", &settings.width, &settings.height) != 2)
+			{
+				std::cout << "Warning: Skipping \"" << line << "\" in " << path << ", the size should be WxH\n";
+				continue;
+			}
+			words >> settings.seed >> settings.ghosts;	//both are optional
+			addLevel(settings);
+		}
+		else
+			addLevel(first);
+		added++;
+	}
+	return added > 0;
+}
+
+/**
+ * @brief Adds the level files of a directory, sorted by name. Files that do not start with the size of a level are skipped.
+ *
+ * @param path - The directory
+ * @return true if any level was added
+ */
+bool Campaign::loadDirectory(const std::string& path)
+{
+	std::vector <std::string> files;
+	std::error_code error;
+	for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(path, error))
+	{
+		if (!file.is_regular_file(error))
+			continue;
+
+		int width, height;
+		std::ifstream level(file.path());
+		std::string line;
+		if (std::getline(level, line) && sscanf(line.c_str(), "%dx%d", &width, &height) == 2)
+			files.push_back(file.path().string());
+	}
+
+	std::sort(files.begin(), files.end());
+	for (const std::string& file : files)
+		addLevel(file);
+	if (files.empty())
+		std::cout << "Warning: No levels in " << path << '\n';
+	return !files.empty();
+}
+
+/**
+ * @brief Loads a level and makes everything it needs, without OpenGL. Runs on the worker thread, except for the first level.
+ *
+ * @param entry - The level
+ * @return The level, or nullptr if it could not be loaded, is cut short or has no Pacman
+ */
+CampaignLevel* Campaign::loadLevel(const Entry& entry)
+{
+	if (!entry.path.empty() && !std::ifstream(entry.path))
+	{
+		std::cout << "Warning: Could not open the level " << entry.path << ", it is skipped\n";
+		return nullptr;
+	}
+
+	CampaignLevel* level = new CampaignLevel{};
+	if (entry.path.empty())
+	{
+		level->name = "a generated " + std::to_string(entry.generatorSettings.width) + 'x' +
+					  std::to_string(entry.generatorSettings.height) + " maze";
+		level->scenario = new ScenarioLoader(MazeGenerator(entry.generatorSettings).generateScenario());
+	}
+	else
+	{
+		level->name = entry.path;
+		level->path = entry.path;
+		level->scenario = new ScenarioLoader(entry.path);
+		if (!level->scenario->isComplete())
+		{
+			std::cout << "Warning: " << level->name << " ends before its last tile, or has something else than a number, it is skipped\n";
+			delete level;
+			return nullptr;
+		}
+	}
+
+	level->maze = new Maze(level->scenario);
+	level->spawns.spawnFromMaze(level->maze, 4.f);
+	level->pacman = level->spawns.findByKind(pacmanActor);
+	if (level->pacman == -1)
+	{
+		std::cout << "Warning: " << level->name << " has no Pacman (2), it is skipped\n";
+		delete level;
+		return nullptr;
+	}
+
+	//the level can still be played, but never finished
+	DistanceField field(level->maze);
+	field.fill({ level->maze->getTileIndex(level->spawns.tileX[level->pacman], level->spawns.tileY[level->pacman]) });
+	int unreachable = field.countUnreached(level->maze->getBitboard().getPellets());
+	if (unreachable > 0)
+		std::cout << "Warning: " << unreachable << " pellets in " << level->name << " can not be reached by Pacman\n";
+
+	level->junctionGraph = new JunctionGraph(level->maze);
+	level->systems = new ActorSystems(m_Actors, level->maze, level->junctionGraph);
+	if (hunting)
+	{
+		level->pathfinder = new HierarchicalPathfinder(level->maze);
+		level->systems->setPathfinder(level->pathfinder);
+	}
+	level->mazeRenderer = new MazeRenderer(level->maze, m_MazeShader, m_PelletsShader, m_Renderer);
+	level->pellets = new Pellets(level->maze, level->mazeRenderer, m_Actors, level->pacman);
+
+	//small mazes are shown whole, larger mazes are shown partly, following Pacman
+	Maze* maze = level->maze;
+	bool largeMaze = maze->getWidth() > 56 || maze->getHeight() > 72;
+	level->camera = new Camera(maze->getWidth(), maze->getHeight(), largeMaze ? 56.f : maze->getWidth(),
+															  largeMaze ? 72.f : maze->getHeight());
+	level->camera->follow(level->spawns.getPosX(level->pacman) + .5f, level->spawns.getPosY(level->pacman) + .5f);
+	level->mazeRenderer->build(*level->camera);
+	return level;
+}
+
+/**
+ * @brief Loads the entries from the next one, until one of them can be played.
+ *
+ * @return The level, or nullptr if none was left
+ */
+CampaignLevel* Campaign::loadNextValid()
+{
+	while (nextEntry < entries.size())
+	{
+		CampaignLevel* level = loadLevel(entries[nextEntry++]);
+		if (level)
+			return level;
+	}
+	return nullptr;
+}
+
+/**
+ * @brief Loads the first level that can be played, on the calling thread.
+ *
+ * @return The level, or nullptr if none could be loaded
+ */
+CampaignLevel* Campaign::loadFirst()
+{
+	if (worker.joinable())
+		worker.join();
+	nextEntry = 0;
+	return loadNextValid();
+}
+
+/**
+ * @brief Starts loading the next level on the worker thread, unless it is already loading or there is none.
+ *
+ */
+void Campaign::prepareNext()
+{
+	if (worker.joinable() || nextEntry >= entries.size())
+		return;
+
+	nextReady.store(false, std::memory_order_relaxed);
+	worker = std::thread([this]()
+	{
+		next = loadNextValid();
+		nextReady.store(true, std::memory_order_release);	//the level is made before the game can see it is ready
+	});
+}
+
+/**
+ * @brief Takes the next level, waiting for the worker if it is not ready yet (see isNextReady()).
+ *
+ * @return The level, owned by the caller, or nullptr if there is none left
+ */
+CampaignLevel* Campaign::takeNext()
+{
+	prepareNext();
+	if (!worker.joinable())
+		return nullptr;
+
+	worker.join();
+	nextReady.store(false, std::memory_order_relaxed);
+	CampaignLevel* level = next;
+	next = nullptr;
+	return level;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file Campaign.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the CampaignLevel struct and the Campaign class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "ScenarioLoader.h"
+#include "MazeGenerator.h"
+#include "Maze.h"
+#include "JunctionGraph.h"
+#include "DistanceField.h"
+#include "HierarchicalPathfinder.h"
+#include "ActorStore.h"
+#include "ActorSystems.h"
+#include "MazeRenderer.h"
+#include "Pellets.h"
+#include "Camera.h"
+#include "Renderer.h"
+#include "Shader.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Everything a level of the campaign needs to be played, made before it is started.
+ * 		  The systems and the pellets work on the game's ActorStore, which gets the spawns when the level starts.
+ *
+ */
+struct CampaignLevel
+{
+	std::string		name;
+	std::string		path;			//the level file, empty for a generated level
+	ScenarioLoader* scenario;
+	Maze*			maze;
+	ActorStore		spawns;			//the actors as they are at the start of the level
+	int				pacman;
+	JunctionGraph*	junctionGraph;
+	ActorSystems*	systems;
+	HierarchicalPathfinder* pathfinder;	//nullptr unless the ghosts hunt, see Campaign::setHunting()
+	MazeRenderer*	mazeRenderer;	//the visible chunks and their pellets are built, but nothing is on the GPU yet
+	Pellets*		pellets;
+	Camera*			camera;
+
+	~CampaignLevel();
+
+	bool setTile(int x, int y, int value);
+	int  respawnBlockedActors(ActorStore* actors) const;
+};
+
+/**
+ * @class Campaign
+ * @brief A sequence of levels, played one after the other. While a level is played, the next one is loaded,
+ * 		  parsed and given its meshes and junction graph on a worker thread, so that starting it only has to
+ * 		  send its meshes to the GPU.
+ * 		  The levels come from a manifest, with a level file or "generate WxH [seed] [ghosts]" per line,
+ * 		  or from a directory, whose level files are played by name.
+ */
+class Campaign
+{
+private:
+	struct Entry
+	{
+		std::string			  path;			//empty for a generated level
+		MazeGeneratorSettings generatorSettings;
+	};
+
+	std::vector <Entry> entries;
+	size_t				nextEntry;		//the first entry that is not loaded or being loaded
+
+	Shader*				m_MazeShader;
+	Shader*				m_PelletsShader;
+	Renderer*			m_Renderer;
+	ActorStore*			m_Actors;		//the game's actors, shared by every level
+	bool				hunting;		//the levels get a HierarchicalPathfinder for the ghosts
+
+	std::thread			worker;
+	std::atomic<bool>	nextReady;
+	CampaignLevel*		next;			//made by the worker, nullptr if no entry left could be loaded
+public:
+	Campaign(Shader* mazeShader, Shader* pelletsShader, Renderer* renderer, ActorStore* actors);
+	~Campaign();
+
+	bool load(const std::string& path);
+	void addLevel(const std::string& path);
+	void addLevel(const MazeGeneratorSettings& settings);
+	int  getLevelCount() const { return (int)entries.size(); }
+	void setHunting(bool hunt) { hunting = hunt; }
+
+	CampaignLevel* loadFirst();
+	void prepareNext();
+	bool isNextReady() const { return nextReady.load(std::memory_order_acquire); }
+	bool hasNext() const { return worker.joinable() || nextEntry < entries.size(); }
+	CampaignLevel* takeNext();
+
+private:
+	bool loadManifest(const std::string& path);
+	bool loadDirectory(const std::string& path);
+	CampaignLevel* loadLevel(const Entry& entry);
+	CampaignLevel* loadNextValid();
+};
@@ -0,0 +1,340 @@
+/**
+ * @file CooperativePlanner.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the CooperativePlanner class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "CooperativePlanner.h"
+#include "ActorStore.h"
+
+#include <algorithm>
+#include <climits>
+
+/**
+ * @brief Construct a new Cooperative Planner:: Cooperative Planner object, without any reservations.
+ *
+ * @param maze 	   - The maze the ghosts move in
+ * @param graph    - The junction graph of the maze, the plans are made of its corridors
+ * @param settings - How the ghosts plan
+ */
+CooperativePlanner::CooperativePlanner(const Maze* maze, JunctionGraph* graph, const CooperativeSettings& settings)
+	: m_Maze(maze),
+	  m_Graph(graph),
+	  settings(settings),
+	  reservationCount(0),
+	  currentSlot(0),
+	  plansLeft(0),
+	  m_Target(nullptr),
+	  planningGhost(-1),
+	  planningTick(0),
+	  ticksPerTile(1),
+	  bestScore(INT_MAX)
+{
+	//a ghost at a quarter of the speed a slot is made for still fits its window in the ring
+	slotKeys.resize((size_t)settings.window * 4 + 2);
+	reservations.assign(256, { emptyKey, -1 });	//grows with the ghosts, see reserve()
+}
+
+/**
+ * @brief Drops every plan and reservation, when the level starts over.
+ *
+ */
+void CooperativePlanner::clear()
+{
+	std::fill(reservations.begin(), reservations.end(), Reservation{ emptyKey, -1 });
+	reservationCount = 0;
+	for (std::vector <uint64_t>& keys : slotKeys)
+		keys.clear();
+	plans.clear();
+	currentSlot = 0;
+}
+
+/**
+ * @brief Takes over the plans and reservations of the planner of another copy of the same game.
+ * 		  The reservations are one flat table, so copying into the same planner again does not allocate.
+ *
+ * @param other - The planner that is copied
+ */
+void CooperativePlanner::copyState(const CooperativePlanner& other)
+{
+	reservations = other.reservations;
+	reservationCount = other.reservationCount;
+	slotKeys = other.slotKeys;
+	currentSlot = other.currentSlot;
+	plans = other.plans;
+}
+
+/**
+ * @brief Starts a tick: the reservations of the time that has passed are dropped, and the ghosts may plan again.
+ *
+ * @param tick 	 - The tick, counted from the start of the level
+ * @param actors - The amount of actors
+ */
+void CooperativePlanner::beginTick(long long tick, int actors)
+{
+	if (plans.size() != (size_t)actors)
+		plans.resize(actors);
+	plansLeft = settings.plansPerTick;
+
+	long long slot = tick / settings.slotTicks;
+	if (slot < currentSlot || slot - currentSlot >= (long long)slotKeys.size())
+	{
+		clear();
+		plans.resize(actors);
+		currentSlot = slot;
+		return;
+	}
+	for (; currentSlot < slot; currentSlot++)
+	{
+		std::vector <uint64_t>& passed = slotKeys[currentSlot % slotKeys.size()];
+		for (uint64_t key : passed)
+			unreserve(key, -1);
+		passed.clear();
+	}
+}
+
+/**
+ * @brief Picks the corridor a chasing ghost takes from a junction. The ghost follows its plan if it is still on it,
+ * 		  otherwise it plans again, if there are plans left in this tick.
+ *
+ * @param ghost  - The index of the ghost
+ * @param tile 	 - The tile index of the junction the ghost has just moved to
+ * @param exits  - The directions the ghost may take, one bit per direction
+ * @param tick 	 - The tick, counted from the start of the level
+ * @param speed  - The speed of the ghost, in ActorStore::tileUnits per tick
+ * @param target - The distance of every tile to Pacman
+ * @return The direction, -1 if the ghost is too far from Pacman or can not plan in this tick
+ */
+int CooperativePlanner::decide(int ghost, int tile, int exits, long long tick, int speed, const DistanceField& target)
+{
+	GhostPlan& current = plans[ghost];
+	if (current.next < current.nodeTiles.size() && current.nodeTiles[current.next] == tile)
+	{
+		Direction direction = current.directions[current.next++];
+		if (exits >> direction & 1)
+			return direction;
+	}
+
+	int node = m_Graph->getNodeOfTile(tile);
+	if (node == -1 || !target.isReached(tile) || plansLeft <= 0 || speed <= 0)
+		return -1;
+	plansLeft--;
+
+	m_Target = &target;
+	release(ghost);
+	plan(ghost, node, exits, tick, speed);
+	if (current.directions.empty())
+		return -1;
+	current.next = 1;
+	return current.directions[0];
+}
+
+/**
+ * @brief Finds the plan of a ghost with the lowest cost, and reserves its tiles.
+ *
+ */
+void CooperativePlanner::plan(int ghost, int node, int exits, long long tick, int speed)
+{
+	planningGhost = ghost;
+	planningTick = tick;
+	ticksPerTile = ActorStore::tileUnits / speed;
+	legs.clear();
+	bestLegs.clear();
+	bestScore = INT_MAX;
+	search(node, exits, 0, 0);
+
+	GhostPlan& chosen = plans[ghost];
+	chosen.nodeTiles.clear();
+	chosen.directions.clear();
+	int steps = 0;
+	for (const Leg& leg : bestLegs)
+	{
+		chosen.nodeTiles.push_back(m_Graph->getNode(leg.node).tile);
+		chosen.directions.push_back(leg.direction);
+
+		const JunctionEdge& edge = m_Graph->getEdge(m_Graph->getNode(leg.node).edges[leg.direction]);
+		const int* edgeTiles = m_Graph->getEdgeTiles(m_Graph->getNode(leg.node).edges[leg.direction]);
+		for (int k = 1; k <= edge.length && steps + k <= settings.window; k++)
+		{
+			long long slot = (tick + (long long)(steps + k) * ticksPerTile) / settings.slotTicks;
+			if (slot - currentSlot >= (long long)slotKeys.size())
+				break;
+			uint64_t key = getKey(slot, k < edge.length ? edgeTiles[k - 1] : m_Graph->getNode(edge.to).tile);
+			if (reserve(key, ghost))
+			{
+				chosen.reserved.push_back(key);
+				slotKeys[slot % slotKeys.size()].push_back(key);
+			}
+		}
+		steps += edge.length;
+	}
+}
+
+/**
+ * @brief Tries every corridor from a junction, and the corridors after it, until the window is full.
+ * 		  A plan costs the tiles it walks, conflictCost for every tile another ghost is on at the same time,
+ * 		  and the distance to Pacman from where it ends.
+ *
+ * @param node 	- The junction
+ * @param exits - The directions the ghost may take from it
+ * @param steps - The tiles walked to the junction
+ * @param cost 	- The cost of the plan to the junction
+ */
+void CooperativePlanner::search(int node, int exits, int steps, int cost)
+{
+	const JunctionNode& junction = m_Graph->getNode(node);
+	for (int d = 0; d < 4; d++)
+	{
+		if (!(exits >> d & 1) || junction.edges[d] == -1)
+			continue;
+
+		const JunctionEdge& edge = m_Graph->getEdge(junction.edges[d]);
+		const int* edgeTiles = m_Graph->getEdgeTiles(junction.edges[d]);
+		legs.push_back({ node, (Direction)d });
+
+		int legCost = cost, score = -1;
+		for (int k = 1; k <= edge.length; k++)
+		{
+			int tile = k < edge.length ? edgeTiles[k - 1] : m_Graph->getNode(edge.to).tile;
+			legCost++;
+
+			//also the slot after, so that ghosts coming from opposite ends of a corridor do not pass through each other
+			long long slot = (planningTick + (long long)(steps + k) * ticksPerTile) / settings.slotTicks;
+			for (long long s = slot; s <= slot + 1; s++)
+			{
+				int reserver = getReserver(getKey(s, tile));
+				if (reserver != -1 && reserver != planningGhost)
+				{
+					legCost += settings.conflictCost;
+					break;
+				}
+			}
+
+			int distance = m_Target->getDistance(tile);
+			if (distance == 0 || steps + k >= settings.window)
+			{
+				score = legCost + (distance == -1 ? m_Target->getFarthest() + 1 : distance);
+				break;
+			}
+		}
+
+		if (score != -1)
+		{
+			if (score < bestScore)
+			{
+				bestScore = score;
+				bestLegs = legs;
+			}
+		}
+		else
+		{
+			//a dead end can only be left the way the ghost came in
+			Direction entered = edge.endDirection;
+			int nextExits = m_Maze->getExits(m_Graph->getNode(edge.to).tile) & ~(1 << opposite(entered));
+			search(edge.to, nextExits ? nextExits : 1 << opposite(entered), steps + edge.length, legCost);
+		}
+		legs.pop_back();
+	}
+}
+
+/**
+ * @brief Drops the reservations of a ghost's plan.
+ *
+ * @param ghost - The index of the ghost
+ */
+void CooperativePlanner::release(int ghost)
+{
+	GhostPlan& released = plans[ghost];
+	for (uint64_t key : released.reserved)
+		unreserve(key, ghost);
+	released.reserved.clear();
+	released.nodeTiles.clear();
+	released.directions.clear();
+	released.next = 0;
+}
+
+/**
+ * @brief Finds the entry of a reservation in the table, with linear probing from the entry its key hashes to.
+ *
+ * @param key - The (time slot, tile) key
+ * @return The index of the entry with the key, or of the free entry where it would go
+ */
+size_t CooperativePlanner::findEntry(uint64_t key) const
+{
+	size_t mask = reservations.size() - 1,
+		   i = getHome(key);
+	while (reservations[i].key != key && reservations[i].key != emptyKey)
+		i = (i + 1) & mask;
+	return i;
+}
+
+/**
+ * @brief Finds the ghost that has reserved a tile at a time.
+ *
+ * @param key - The (time slot, tile) key
+ * @return The index of the ghost, -1 if the tile is free
+ */
+int CooperativePlanner::getReserver(uint64_t key) const
+{
+	const Reservation& entry = reservations[findEntry(key)];
+	return entry.key == key ? entry.ghost : -1;
+}
+
+/**
+ * @brief Reserves a tile at a time for a ghost, unless it is reserved already. The table is kept at most half full,
+ * 		  and doubles when it would get fuller.
+ *
+ * @param key 	- The (time slot, tile) key
+ * @param ghost - The index of the ghost
+ * @return true if the tile was free
+ */
+bool CooperativePlanner::reserve(uint64_t key, int ghost)
+{
+	size_t i = findEntry(key);
+	if (reservations[i].key == key)
+		return false;
+
+	if ((size_t)(reservationCount + 1) * 2 > reservations.size())
+	{
+		std::vector <Reservation> old(reservations.size() * 2, { emptyKey, -1 });
+		old.swap(reservations);
+		for (const Reservation& entry : old)
+			if (entry.key != emptyKey)
+				reservations[findEntry(entry.key)] = entry;
+		i = findEntry(key);
+	}
+	reservations[i] = { key, ghost };
+	reservationCount++;
+	return true;
+}
+
+/**
+ * @brief Drops a reservation. The entries after it that were pushed past their place are moved back,
+ * 		  so the table never needs markers for removed entries.
+ *
+ * @param key 	- The (time slot, tile) key
+ * @param ghost - Only drops the reservation if it is this ghost's, -1 for any ghost
+ */
+void CooperativePlanner::unreserve(uint64_t key, int ghost)
+{
+	size_t i = findEntry(key);
+	if (reservations[i].key != key || (ghost != -1 && reservations[i].ghost != ghost))
+		return;
+
+	size_t mask = reservations.size() - 1;
+	for (size_t j = (i + 1) & mask; reservations[j].key != emptyKey; j = (j + 1) & mask)
+	{
+		size_t home = getHome(reservations[j].key);
+		if (((j - home) & mask) >= ((j - i) & mask))	//the hole is between the entry's place and the entry
+		{
+			reservations[i] = reservations[j];
+			i = j;
+		}
+	}
+	reservations[i] = { emptyKey, -1 };
+	reservationCount--;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file CooperativePlanner.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the CooperativePlanner class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+#include "JunctionGraph.h"
+#include "DistanceField.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief How the CooperativePlanner plans.
+ *
+ */
+struct CooperativeSettings
+{
+	int window = 16;		//how far ahead a ghost plans and reserves, in tiles
+	int plansPerTick = 8;	//the most plans made in one tick, the other ghosts keep their plans or go straight for Pacman
+	int slotTicks = 32;		//the length of a reservation, one tile at 4 tiles per second
+	int conflictCost = 8;	//how many tiles of detour a ghost takes to not meet another ghost
+};
+
+/**
+ * @class CooperativePlanner
+ * @brief Plans the way of the chasing ghosts together, so that they spread out over the corridors around Pacman instead of
+ * 		  following each other. A plan is the corridors a ghost takes from the junction it is on, a window of tiles ahead,
+ * 		  and every tile of the plan is reserved for the time the ghost will be there. The next ghost plans around those
+ * 		  reservations: every tile another ghost has reserved at the same time, or just after, makes a corridor cost more.
+ * 		  Only a few ghosts plan per tick, the others follow their plans, so the cost of a tick stays the same with more ghosts.
+ */
+class CooperativePlanner
+{
+private:
+	struct GhostPlan
+	{
+		std::vector <int>		nodeTiles;	//the junctions of the plan, and the direction taken on each of them
+		std::vector <Direction> directions;
+		size_t					next = 0;
+		std::vector <uint64_t>	reserved;	//the reservations made for the plan
+	};
+
+	struct Leg
+	{
+		int		  node;
+		Direction direction;
+	};
+
+	struct Reservation
+	{
+		uint64_t key;	//emptyKey when the entry is free
+		int		 ghost;
+	};
+	static const uint64_t emptyKey = ~uint64_t(0);
+
+	const Maze*		   m_Maze;
+	JunctionGraph*	   m_Graph;
+	CooperativeSettings settings;
+
+	std::vector <Reservation> reservations;	//(time slot, tile) to the ghost that has reserved it, open addressed, see findEntry()
+	int				   reservationCount;
+	std::vector <std::vector <uint64_t>> slotKeys;		//the reservations of the slots ahead, in a ring, to drop them when they have passed
+	long long		   currentSlot;
+	std::vector <GhostPlan> plans;
+	int				   plansLeft;			//in this tick
+
+	//the search of a plan
+	const DistanceField* m_Target;
+	int				   planningGhost;
+	long long		   planningTick;
+	int				   ticksPerTile;
+	std::vector <Leg>  legs,
+					   bestLegs;
+	int				   bestScore;
+public:
+	CooperativePlanner(const Maze* maze, JunctionGraph* graph, const CooperativeSettings& settings = CooperativeSettings());
+
+	void clear();
+	void copyState(const CooperativePlanner& other);
+	void beginTick(long long tick, int actors);
+	int  decide(int ghost, int tile, int exits, long long tick, int speed, const DistanceField& target);
+	int  getReservationCount() const { return reservationCount; }
+
+private:
+	void plan(int ghost, int node, int exits, long long tick, int speed);
+	void search(int node, int exits, int steps, int cost);
+	void release(int ghost);
+
+	size_t findEntry(uint64_t key) const;
+	int  getReserver(uint64_t key) const;
+	bool reserve(uint64_t key, int ghost);
+	void unreserve(uint64_t key, int ghost);
+	uint64_t getKey(long long slot, int tile) const { return (uint64_t)slot * (uint64_t)(m_Maze->getWidth() * m_Maze->getHeight()) + tile; }
+	size_t getHome(uint64_t key) const	//the entry of the table a key hashes to
+	{
+		uint64_t hash = key * 0x9E3779B97F4A7C15ull;
+		return (size_t)(hash ^ hash >> 32) & (reservations.size() - 1);
+	}
+};
@@ -0,0 +1,345 @@
+/**
+ * @file DistanceField.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the DistanceField class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "DistanceField.h"
+
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	//the tiles of a word that can be reached from some of them without leaving open, along the row in both directions
+	uint64_t fillRow(uint64_t bits, uint64_t open)
+	{
+		uint64_t up = bits, upOpen = open,
+				 down = bits, downOpen = open;
+		for (int shift = 1; shift < 64; shift *= 2)
+		{
+			up |= upOpen & up << shift;
+			upOpen &= upOpen << shift;
+			down |= downOpen & down >> shift;
+			downOpen &= downOpen >> shift;
+		}
+		return up | down;
+	}
+
+	//the index of the lowest set bit, bits may not be 0
+	int lowestBit(uint64_t bits)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, bits);
+		return (int)index;
+#else
+		return __builtin_ctzll(bits);
+#endif
+	}
+}
+
+/**
+ * @brief Construct a new Distance Field:: Distance Field object, nothing is reached until compute() is called.
+ *
+ * @param maze - The maze that is searched
+ */
+DistanceField::DistanceField(const Maze* maze)
+	: m_Maze(maze),
+	  farthest(-1)
+{
+	size_t words = m_Maze->getBitboard().getWordCount();
+	reached.assign(words, 0);
+	frontier.assign(words, 0);
+	next.assign(words, 0);
+}
+
+/**
+ * @brief Finds the distance of the tiles to one tile.
+ *
+ * @param source 	  - The tile index the search starts from
+ * @param maxDistance - The search stops after this distance, -1 to search the whole maze
+ * @param outputs 	  - DistanceFieldOutput flags, what is written besides the reached tiles
+ * @return The distance of the farthest reached tile, -1 if the source is a wall
+ */
+int DistanceField::compute(int source, int maxDistance, int outputs)
+{
+	return compute(std::vector <int>(1, source), maxDistance, outputs);
+}
+
+/**
+ * @brief Finds the distance of the tiles to the nearest of some tiles, searching from all of them at once.
+ * 		  Sources that are walls are skipped.
+ *
+ * @param sources 	  - The tile indices the search starts from
+ * @param maxDistance - The search stops after this distance, -1 to search the whole maze
+ * @param outputs 	  - DistanceFieldOutput flags, what is written besides the reached tiles
+ * @return The distance of the farthest reached tile, -1 if every source is a wall
+ */
+int DistanceField::compute(const std::vector <int>& sources, int maxDistance, int outputs)
+{
+	const MazeBitboard& bitboard = m_Maze->getBitboard();
+	int width = m_Maze->getWidth(),
+		wordsPerRow = bitboard.getWordsPerRow();
+
+	clear();
+	if ((outputs & distancesOutput) && distances.size() != (size_t)width * m_Maze->getHeight())
+		distances.resize((size_t)width * m_Maze->getHeight());
+
+	for (int tile : sources)
+	{
+		int x = tile % width, y = tile / width;
+		reach((uint32_t)(y * wordsPerRow + x / 64), uint64_t(1) << (x % 64));
+	}
+
+	for (int distance = 0; !nextWords.empty(); distance++)
+	{
+		takeLayer(distance, outputs);
+		farthest = distance;
+
+		frontier.swap(next);
+		frontierWords.swap(nextWords);
+		nextWords.clear();
+		if (distance == maxDistance)
+		{
+			for (uint32_t word : frontierWords)
+				frontier[word] = 0;
+			break;
+		}
+
+		for (uint32_t word : frontierWords)
+		{
+			expand(word, frontier[word]);
+			frontier[word] = 0;
+		}
+	}
+	frontierWords.clear();
+	if (outputs & layersOutput)
+		layerStarts.push_back(layerWords.size());
+	return farthest;
+}
+
+/**
+ * @brief Finds the tiles that can be reached from any of some tiles, without their distances, which is a lot faster than compute().
+ * 		  A word is filled along its corridors all at once, instead of one tile per step, and only the rows above and below
+ * 		  and the words on its sides are left for later.
+ *
+ * @param sources - The tile indices the search starts from, sources that are walls are skipped
+ * @return The amount of reached tiles
+ */
+int DistanceField::fill(const std::vector <int>& sources)
+{
+	const MazeBitboard& bitboard = m_Maze->getBitboard();
+	const uint64_t* walkable = bitboard.getWalkable();
+	int width = m_Maze->getWidth(),
+		lastBit = (width - 1) % 64;
+	uint32_t wordsPerRow = (uint32_t)bitboard.getWordsPerRow(),
+			 wordCount = (uint32_t)reached.size();
+
+	clear();
+
+	//next holds the reached tiles of every word in nextWords that have not been filled from yet
+	for (int tile : sources)
+	{
+		int x = tile % width, y = tile / width;
+		reach((uint32_t)(y * wordsPerRow + x / 64), uint64_t(1) << (x % 64));
+	}
+
+	while (!nextWords.empty())
+	{
+		uint32_t word = nextWords.back();
+		nextWords.pop_back();
+		uint64_t bits = fillRow(next[word], walkable[word]);
+		next[word] = 0;
+		reached[word] |= bits;
+
+		reach(word >= wordsPerRow ? word - wordsPerRow : word + wordCount - wordsPerRow, bits);
+		reach(word + wordsPerRow < wordCount ? word + wordsPerRow : word + wordsPerRow - wordCount, bits);
+		if (!(bits & (uint64_t(1) | uint64_t(1) << 63 | uint64_t(1) << lastBit)))
+			continue;
+		uint32_t w = word % wordsPerRow,
+				 row = word - w;
+		reach(w + 1 < wordsPerRow ? word + 1 : row, w + 1 < wordsPerRow ? bits >> 63 : bits >> lastBit & 1);
+		reach(w > 0 ? word - 1 : row + wordsPerRow - 1, w > 0 ? bits << 63 : (bits & 1) << lastBit);
+	}
+	return countReached();
+}
+
+/**
+ * @brief Takes over the last search of another field of the same maze, instead of searching again.
+ * 		  Only the words the searches reached are touched, and the field keeps its memory once it has been used.
+ *
+ * @param other - The field that is copied
+ */
+void DistanceField::copyFrom(const DistanceField& other)
+{
+	int width = m_Maze->getWidth(),
+		wordsPerRow = m_Maze->getBitboard().getWordsPerRow();
+
+	clear();
+	reachedWords = other.reachedWords;
+	if (distances.size() != other.distances.size())
+		distances.resize(other.distances.size());
+	for (uint32_t word : reachedWords)
+	{
+		reached[word] = other.reached[word];
+		if (distances.empty())
+			continue;
+		int first = (int)(word / wordsPerRow) * width + (int)(word % wordsPerRow) * 64,
+			count = std::min(64, width - (int)(word % wordsPerRow) * 64);
+		std::copy(other.distances.begin() + first, other.distances.begin() + first + count, distances.begin() + first);
+	}
+	layerStarts = other.layerStarts;
+	layerWords = other.layerWords;
+	farthest = other.farthest;
+}
+
+/**
+ * @brief Forgets the last search.
+ *
+ */
+void DistanceField::clear()
+{
+	for (uint32_t word : reachedWords)
+		reached[word] = 0;
+	reachedWords.clear();
+	layerStarts.clear();
+	layerWords.clear();
+	farthest = -1;
+}
+
+/**
+ * @brief Adds tiles of a word to the next distance, leaving out the walls and the tiles that have been reached.
+ *
+ * @param word - The index of the word in the planes
+ * @param bits - The tiles
+ */
+void DistanceField::reach(uint32_t word, uint64_t bits)
+{
+	if (!bits)
+		return;
+	bits &= m_Maze->getBitboard().getWalkable()[word] & ~reached[word];
+	if (!bits)
+		return;
+
+	if (!next[word])
+		nextWords.push_back(word);
+	if (!reached[word])
+		reachedWords.push_back(word);
+	next[word] |= bits;
+	reached[word] |= bits;
+}
+
+/**
+ * @brief Takes frontier tiles of a word one step in every direction. The tiles that leave a word to the side are carried
+ * 		  to the neighbouring word, and the tiles on the edges of the maze wrap around to the opposite edge.
+ *
+ * @param word - The index of the word in the planes
+ * @param bits - The frontier tiles of the word
+ */
+void DistanceField::expand(uint32_t word, uint64_t bits)
+{
+	const MazeBitboard& bitboard = m_Maze->getBitboard();
+	uint32_t wordsPerRow = (uint32_t)bitboard.getWordsPerRow(),
+			 wordCount = (uint32_t)reached.size();
+	int lastBit = (bitboard.getWidth() - 1) % 64;
+
+	//the bit past the width in the last word is padding, and is never walkable
+	reach(word, bits | bits << 1 | bits >> 1);
+	reach(word >= wordsPerRow ? word - wordsPerRow : word + wordCount - wordsPerRow, bits);
+	reach(word + wordsPerRow < wordCount ? word + wordsPerRow : word + wordsPerRow - wordCount, bits);
+
+	//most words have no tiles on their sides, and do not need to find where they are in the row
+	if (!(bits & (uint64_t(1) | uint64_t(1) << 63 | uint64_t(1) << lastBit)))
+		return;
+	uint32_t w = word % wordsPerRow,
+			 row = word - w;
+	if (w + 1 < wordsPerRow)
+		reach(word + 1, bits >> 63);
+	else
+		reach(row, bits >> lastBit & 1);	//right over the edge
+	if (w > 0)
+		reach(word - 1, bits << 63);
+	else
+		reach(row + wordsPerRow - 1, (bits & 1) << lastBit);	//left over the edge
+}
+
+/**
+ * @brief Writes the distance of the tiles in next, before they become the frontier.
+ *
+ * @param distance - Their distance
+ * @param outputs  - DistanceFieldOutput flags
+ */
+void DistanceField::takeLayer(int distance, int outputs)
+{
+	if (outputs & layersOutput)
+	{
+		layerStarts.push_back(layerWords.size());
+		for (uint32_t word : nextWords)
+			layerWords.push_back({ word, next[word] });
+	}
+
+	if (outputs & distancesOutput)
+	{
+		const MazeBitboard& bitboard = m_Maze->getBitboard();
+		int width = bitboard.getWidth(),
+			wordsPerRow = bitboard.getWordsPerRow();
+		for (uint32_t word : nextWords)
+		{
+			int first = (int)(word / wordsPerRow) * width + (int)(word % wordsPerRow) * 64;
+			for (uint64_t bits = next[word]; bits; bits &= bits - 1)
+				distances[first + lowestBit(bits)] = distance;
+		}
+	}
+}
+
+/**
+ * @brief Checks if a tile was reached by the last search.
+ *
+ * @param tile - The tile index
+ * @return true if it was reached
+ */
+bool DistanceField::isReached(int tile) const
+{
+	int width = m_Maze->getWidth();
+	int x = tile % width, y = tile / width;
+	return reached[(size_t)y * m_Maze->getBitboard().getWordsPerRow() + x / 64] >> (x % 64) & 1;
+}
+
+/**
+ * @brief Counts the tiles reached by the last search.
+ *
+ * @return The amount of tiles
+ */
+int DistanceField::countReached() const
+{
+	int count = 0;
+	for (uint32_t word : reachedWords)
+		count += MazeBitboard::countBits(&reached[word], 1);
+	return count;
+}
+
+/**
+ * @brief Counts the tiles of a plane that were not reached by the last search,
+ * 		  such as the pellets Pacman can not get to (see MazeBitboard::getPellets()).
+ *
+ * @param plane - A plane of the Maze's MazeBitboard, or one laid out like it
+ * @return The amount of tiles
+ */
+int DistanceField::countUnreached(const uint64_t* plane) const
+{
+	int count = 0;
+	for (size_t i = 0; i < reached.size(); i++)
+	{
+		uint64_t word = plane[i] & ~reached[i];
+		count += MazeBitboard::countBits(&word, 1);
+	}
+	return count;
+}
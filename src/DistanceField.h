@@ -0,0 +1,85 @@
+/**
+ * @file DistanceField.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the DistanceField class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief What DistanceField::compute() writes besides the reached tiles, the flags can be combined.
+ *
+ */
+enum DistanceFieldOutput : int
+{
+	reachedOutput = 0,		//only the tiles that can be reached
+	distancesOutput = 1,	//the distance of every reached tile, see getDistance()
+	layersOutput = 2		//the tiles of every distance as words of bits, see getLayerStart()
+};
+
+/**
+ * @brief A word of the bit-planes that gained tiles at a distance, see DistanceField::getLayerStart().
+ *
+ */
+struct DistanceLayerWord
+{
+	uint32_t word;	//the index of the word in the planes of the MazeBitboard
+	uint64_t bits;	//the tiles of the word that are at the distance
+};
+
+/**
+ * @class DistanceField
+ * @brief Breadth first search over the bit-planes of the Maze's MazeBitboard, for the distance of every tile to the nearest
+ * 		  of one or more sources (Pacman, all ghosts at once). Every step of the search moves the frontier one tile,
+ * 		  64 tiles per word operation, and only the words of the frontier are touched, so a step costs as much as
+ * 		  the frontier is long and not as much as the maze is large.
+ * 		  A search that is stopped at a distance only clears and touches the words it reaches, and costs as much on a huge maze as on a small one.
+ * 		  The walls are read from the Maze when the search runs, so tiles changed with Maze::setTile() are taken into account.
+ */
+class DistanceField
+{
+private:
+	const Maze*			   m_Maze;
+	std::vector <uint64_t> reached,
+						   frontier,		//the tiles at the current distance, 0 outside of the search
+						   next;			//the tiles at the next distance, 0 outside of the search
+	std::vector <uint32_t> frontierWords,	//the words of frontier that have any bits
+						   nextWords,
+						   reachedWords;	//the words of reached that have any bits, cleared before the next search
+	std::vector <int>	   distances;		//per tile, only valid for reached tiles, and only written with distancesOutput
+	std::vector <size_t>   layerStarts;
+	std::vector <DistanceLayerWord> layerWords;
+	int					   farthest;		//the distance of the last layer, -1 when nothing was reached
+public:
+	DistanceField(const Maze* maze);
+
+	int compute(int source, int maxDistance = -1, int outputs = distancesOutput);
+	int compute(const std::vector <int>& sources, int maxDistance = -1, int outputs = distancesOutput);
+	int fill(const std::vector <int>& sources);
+	void copyFrom(const DistanceField& other);
+
+	bool isReached(int tile) const;
+	int  getDistance(int tile) const { return isReached(tile) ? distances[tile] : -1; }
+	int  getFarthest() const { return farthest; }
+	int  countReached() const;
+	int  countUnreached(const uint64_t* plane) const;
+	const uint64_t* getReached() const { return reached.data(); }
+
+	int getLayerCount() const { return layerStarts.empty() ? 0 : (int)layerStarts.size() - 1; }
+	size_t getLayerStart(int distance) const { return layerStarts[distance]; }
+	const DistanceLayerWord& getLayerWord(size_t index) const { return layerWords[index]; }
+
+private:
+	void clear();
+	void reach(uint32_t word, uint64_t bits);
+	void expand(uint32_t word, uint64_t bits);
+	void takeLayer(int distance, int outputs);
+};
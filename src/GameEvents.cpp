@@ -0,0 +1,99 @@
+/**
+ * @file GameEvents.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the GameEventRing and GameEvents classes
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "GameEvents.h"
+
+/**
+ * @brief Construct a new Game Event Ring:: Game Event Ring object
+ *
+ * @param capacity - The most events the ring holds, rounded up to a power of two
+ */
+GameEventRing::GameEventRing(size_t capacity)
+	: head(0),
+	  tail(0),
+	  dropped(0)
+{
+	size_t size = 1;
+	while (size < capacity) size <<= 1;
+	events.resize(size);
+	mask = size - 1;
+}
+
+/**
+ * @brief Adds an event, from the producer's thread.
+ *
+ * @param event - The event
+ * @return false if the ring was full, and the event was dropped
+ */
+bool GameEventRing::push(const GameEvent& event)
+{
+	size_t end = tail.load(std::memory_order_relaxed);
+	if (end - head.load(std::memory_order_acquire) == events.size())
+	{
+		dropped++;
+		return false;
+	}
+
+	events[end & mask] = event;
+	tail.store(end + 1, std::memory_order_release);	//the event is written before the consumer can see it
+	return true;
+}
+
+/**
+ * @brief Takes every event in the ring, from the consumer's thread.
+ *
+ * @param out - The events are added to the end of it
+ * @return The amount of events taken
+ */
+size_t GameEventRing::drain(std::vector <GameEvent>& out)
+{
+	size_t start = head.load(std::memory_order_relaxed),
+		   end = tail.load(std::memory_order_acquire);
+	for (size_t i = start; i != end; i++)
+		out.push_back(events[i & mask]);
+	head.store(end, std::memory_order_release);	//the slots are read before the producer can reuse them
+	return end - start;
+}
+
+/**
+ * @brief Destroy the Game Events:: Game Events object, and its rings.
+ *
+ */
+GameEvents::~GameEvents()
+{
+	for (GameEventRing* ring : rings)
+		delete ring;
+}
+
+/**
+ * @brief Makes a ring for a new producer. The producers are added while the game is set up, before any event is sent.
+ *
+ * @param capacity - The most events the producer can send between two drains
+ * @return The producer's ring
+ */
+GameEventRing* GameEvents::addProducer(size_t capacity)
+{
+	rings.push_back(new GameEventRing(capacity));
+	return rings.back();
+}
+
+/**
+ * @brief Takes the events of every producer, once per frame. The events of one producer keep their order.
+ *
+ * @param frameEvents - Cleared, and filled with the events
+ * @return The amount of events
+ */
+size_t GameEvents::drain(std::vector <GameEvent>& frameEvents)
+{
+	frameEvents.clear();
+	for (GameEventRing* ring : rings)
+		ring->drain(frameEvents);
+	return frameEvents.size();
+}
@@ -0,0 +1,76 @@
+/**
+ * @file GameEvents.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the game events, the GameEventRing class and the GameEvents class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief What has happened in the game.
+ *
+ */
+enum GameEventType
+{
+	pelletEaten = 0,
+	pacmanCaught = 1,
+	levelCleared = 2
+};
+
+/**
+ * @brief Something that has happened in the game, sent from the simulation to whoever wants to know.
+ *
+ */
+struct GameEvent
+{
+	GameEventType type;
+	int			  actor;	//the actor it happened to, -1 for none
+	int			  tile;		//the tile it happened on, -1 for none
+};
+
+/**
+ * @class GameEventRing
+ * @brief A bounded ring of events from one producer to one consumer, without locks. The producer only writes the tail,
+ * 		  and the consumer only writes the head, so they can be on different threads.
+ * 		  When the ring is full, new events are dropped and counted, the producer never waits.
+ */
+class GameEventRing
+{
+private:
+	std::vector <GameEvent> events;
+	size_t					mask;		//the capacity is a power of two, the index of an event is its count & mask
+
+	alignas(64) std::atomic<size_t> head;	//the events the consumer has taken, on its own cache line
+	alignas(64) std::atomic<size_t> tail;	//the events the producer has added
+	size_t					dropped;	//only touched by the producer
+public:
+	GameEventRing(size_t capacity);
+
+	bool   push(const GameEvent& event);
+	size_t drain(std::vector <GameEvent>& out);
+	size_t getDropped() const { return dropped; }
+};
+
+/**
+ * @class GameEvents
+ * @brief The event stream of the game: one GameEventRing per producer (the ActorSystems, the Pellets, ...), drained together
+ * 		  once per frame into a list that every consumer (text output, HUD, stats, ...) reads. The consumers never look at the
+ * 		  game objects, and the producers never take a lock.
+ */
+class GameEvents
+{
+private:
+	std::vector <GameEventRing*> rings;
+public:
+	~GameEvents();
+
+	GameEventRing* addProducer(size_t capacity = 1024);
+	size_t drain(std::vector <GameEvent>& frameEvents);
+};
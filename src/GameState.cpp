@@ -0,0 +1,136 @@
+/**
+ * @file GameState.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the GameState class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "GameState.h"
+
+#include <algorithm>
+
+/**
+ * @brief Construct a new Game State:: Game State object, at the start of the level.
+ *
+ * @param level  - The level, with the spawns already taken out by ActorStore::spawnFromMaze. It is shared by every copy
+ * @param spawns - The actors spawned from the level, there has to be a Pacman
+ * @param graph  - The junction graph of the level, it can be shared by many games
+ */
+GameState::GameState(const Maze* level, const ActorStore* spawns, JunctionGraph* graph)
+	: m_Level(level),
+	  m_Spawns(spawns),
+	  actors(*spawns),
+	  systems(&actors, level, graph)
+{
+	player = m_Spawns->findByKind(pacmanActor);
+	reset(0);
+}
+
+/**
+ * @brief Construct a new Game State:: Game State object, a copy of another game.
+ *
+ * @param other - The game that is copied
+ */
+GameState::GameState(const GameState& other)
+	: m_Level(other.m_Level),
+	  m_Spawns(other.m_Spawns),
+	  systems(&actors, other.m_Level, other.systems.getGraph())
+{
+	*this = other;
+}
+
+/**
+ * @brief Copies another game of the same level. The arrays keep their memory, so copying into the same
+ * 		  game over and over does not allocate.
+ *
+ * @param other - The game that is copied
+ * @return This game
+ */
+GameState& GameState::operator=(const GameState& other)
+{
+	actors = other.actors;
+	systems.copyState(other.systems);
+	pellets = other.pellets;
+	player = other.player;
+	remainingPellets = other.remainingPellets;
+	eatenPellets = other.eatenPellets;
+	return *this;
+}
+
+/**
+ * @brief Starts the level over, with every pellet and every actor back on its spawn.
+ *
+ * @param seed - The seed for the ghosts' choices
+ */
+void GameState::reset(unsigned int seed)
+{
+	actors = *m_Spawns;
+	systems.seed(seed);
+
+	pellets.resize((size_t)m_Level->getWidth() * m_Level->getHeight());
+	countPellets(*m_Level);
+	eatenPellets.clear();
+}
+
+/**
+ * @brief Takes over a game that is played outside of a GameState, like the one in main.cpp, in the same level.
+ *
+ * @param maze 	 - The maze of the game, holding the pellets that are left
+ * @param actors - The actors of the game
+ */
+void GameState::copyFrom(const Maze& maze, const ActorStore& actors)
+{
+	this->actors = actors;
+	countPellets(maze);
+	eatenPellets.clear();
+}
+
+/**
+ * @brief Marks the tiles that have a pellet in a maze, going through the maze's pellet tiles instead of every tile.
+ *
+ * @param maze - The maze holding the pellets, the level or one laid out like it
+ */
+void GameState::countPellets(const Maze& maze)
+{
+	std::fill(pellets.begin(), pellets.end(), 0);
+	remainingPellets = 0;
+	int width = maze.getWidth();
+	for (int tile : maze.getPelletTiles())
+		if (maze.hasPellet(tile % width, tile / width))
+		{
+			pellets[tile] = 1;
+			remainingPellets++;
+		}
+}
+
+/**
+ * @brief Steers Pacman and runs the simulation for a number of ticks, or until the game is over.
+ * 		  Pacman eats the pellet on its tile after every tick.
+ *
+ * @param action - The direction Pacman turns to (see ActorSystems::turn()), or noAction
+ * @param ticks  - The amount of ticks
+ * @return The amount of pellets eaten
+ */
+int GameState::step(int action, int ticks)
+{
+	if (action >= up && action <= left)
+		systems.turn(player, (Direction)action);
+
+	eatenPellets.clear();
+	for (int i = 0; i < ticks && !isOver(); i++)
+	{
+		systems.tick();
+
+		int tile = m_Level->getTileIndex(actors.tileX[player], actors.tileY[player]);
+		if (actors.alive[player] && pellets[tile])
+		{
+			pellets[tile] = 0;
+			eatenPellets.push_back(tile);
+			remainingPellets--;
+		}
+	}
+	return (int)eatenPellets.size();
+}
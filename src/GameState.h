@@ -0,0 +1,62 @@
+/**
+ * @file GameState.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the GameState class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+#include "ActorStore.h"
+#include "ActorSystems.h"
+#include "JunctionGraph.h"
+
+#include <vector>
+
+/**
+ * @class GameState
+ * @brief One game without any window or OpenGL: the pellets, the actors and their systems, in a level that is shared.
+ * 		  It is stepped with an action for Pacman instead of the keyboard, so that it can be run many times side by side,
+ * 		  like in the vectorized environment (env/PacmanEnv.h), and copied cheaply, like in the Autopilot's search.
+ */
+class GameState
+{
+private:
+	const Maze*		  m_Level;		//the walls and exits, and the pellets the game starts with
+	const ActorStore* m_Spawns;		//the actors as they are spawned
+
+	ActorStore		  actors;
+	ActorSystems	  systems;
+	std::vector <unsigned char> pellets;	//per tile, 1 while it has a pellet
+	int				  player,
+					  remainingPellets;
+	std::vector <int> eatenPellets;	//the tiles whose pellets were eaten during the last step
+public:
+	static const int noAction = -1;	//Pacman keeps going in its direction
+
+	GameState(const Maze* level, const ActorStore* spawns, JunctionGraph* graph);
+	GameState(const GameState& other);
+	GameState& operator=(const GameState& other);
+
+	void reset(unsigned int seed);
+	void reseed(unsigned int seed) { systems.seed(seed); }
+	void setChaseDistance(int tiles) { systems.setChaseDistance(tiles); }
+	void setCooperative(bool cooperative) { systems.setCooperative(cooperative); }
+	void copyFrom(const Maze& maze, const ActorStore& actors);
+	int  step(int action, int ticks);
+
+	bool isOver() const { return !actors.alive[player] || remainingPellets == 0; }
+	bool isCleared() const { return remainingPellets == 0; }
+	bool hasPellet(int x, int y) const { return pellets[m_Level->getTileIndex(x, y)] != 0; }
+	int  getRemainingPellets() const { return remainingPellets; }
+	int  getPlayer() const { return player; }
+	const Maze& getMaze() const { return *m_Level; }	//for the walls, the pellets are in hasPellet()
+	const ActorStore& getActors() const { return actors; }
+	const std::vector <int>& getEatenPellets() const { return eatenPellets; }
+
+private:
+	void countPellets(const Maze& maze);
+};
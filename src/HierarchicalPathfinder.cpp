@@ -0,0 +1,545 @@
+/**
+ * @file HierarchicalPathfinder.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the HierarchicalPathfinder class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "HierarchicalPathfinder.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <tuple>
+
+/**
+ * @brief Construct a new Hierarchical Pathfinder:: Hierarchical Pathfinder object, and finds the clusters and entrances of the maze.
+ *
+ * @param maze 		  - The maze
+ * @param clusterSize - The width and height of a cluster in tiles, larger clusters make a smaller graph but slower searches at the ends of a path
+ */
+HierarchicalPathfinder::HierarchicalPathfinder(const Maze* maze, int clusterSize)
+	: m_Maze(maze),
+	  clusterSize(clusterSize),
+	  nodeSearch(0)
+{
+	int width = m_Maze->getWidth(), height = m_Maze->getHeight();
+	clustersX = (width + clusterSize - 1) / clusterSize;
+	clustersY = (height + clusterSize - 1) / clusterSize;
+
+	clusters.resize((size_t)clustersX * clustersY);
+	for (int cy = 0; cy < clustersY; cy++)
+		for (int cx = 0; cx < clustersX; cx++)
+		{
+			Cluster& cluster = clusters[cy * clustersX + cx];
+			cluster.left = cx * clusterSize;
+			cluster.top = cy * clusterSize;
+			cluster.width = std::min(clusterSize, width - cluster.left);
+			cluster.height = std::min(clusterSize, height - cluster.top);
+			cluster.borderDirty[0] = cluster.borderDirty[1] = cluster.dirty = false;
+		}
+
+	build();
+}
+
+/**
+ * @brief Finds every entrance, and the distances between the nodes of every cluster.
+ * 		  The distances are found on several threads, every cluster only writes to the edges of its own nodes.
+ *
+ * @param threads - The amount of threads, 0 for one per hardware thread
+ */
+void HierarchicalPathfinder::build(int threads)
+{
+	nodes.clear();
+	freeNodes.clear();
+	dirtyClusters.clear();
+	for (Cluster& cluster : clusters)
+	{
+		cluster.nodes.clear();
+		cluster.borderNodes[0].clear();
+		cluster.borderNodes[1].clear();
+		cluster.borderDirty[0] = cluster.borderDirty[1] = cluster.dirty = false;
+	}
+
+	for (int cluster = 0; cluster < (int)clusters.size(); cluster++)
+	{
+		buildBorder(cluster, 0);
+		buildBorder(cluster, 1);
+	}
+	int clusterCount = (int)clusters.size();
+	threads = threads > 0 ? threads : (int)std::thread::hardware_concurrency();
+	threads = std::max(1, std::min(threads, clusterCount / 64));
+
+	std::vector <std::thread> workers;
+	for (int t = 1; t < threads; t++)
+		workers.emplace_back([this, t, threads, clusterCount]() {
+			ClusterSearch search;
+			for (int cluster = t; cluster < clusterCount; cluster += threads)
+				buildEdges(cluster, search);
+		});
+	for (int cluster = 0; cluster < clusterCount; cluster += threads)
+		buildEdges(cluster, local);
+	for (auto& worker : workers)
+		worker.join();
+}
+
+/**
+ * @brief Tells the pathfinder that a tile has changed (see Maze::setTile()). The cluster of the tile, and the entrances on its
+ * 		  edges if the tile is on one, are found again before the next path is found.
+ *
+ * @param tile - The tile index
+ */
+void HierarchicalPathfinder::updateTile(int tile)
+{
+	int x = tile % m_Maze->getWidth(), y = tile / m_Maze->getWidth();
+	int cluster = getClusterOfTile(tile),
+		cx = cluster % clustersX,
+		cy = cluster / clustersX;
+
+	auto markDirty = [&](int dirty, int side)
+	{
+		if (side != -1)
+			clusters[dirty].borderDirty[side] = true;
+		if (!clusters[dirty].dirty)
+		{
+			clusters[dirty].dirty = true;
+			dirtyClusters.push_back(dirty);
+		}
+	};
+
+	const Cluster& changed = clusters[cluster];
+	markDirty(cluster, -1);
+	if (x == changed.left + changed.width - 1) markDirty(cluster, 0);
+	if (y == changed.top + changed.height - 1) markDirty(cluster, 1);
+	if (x == changed.left) markDirty(cy * clustersX + (cx + clustersX - 1) % clustersX, 0);	//the right edge of the cluster to the left
+	if (y == changed.top)  markDirty((cy + clustersY - 1) % clustersY * clustersX + cx, 1);
+}
+
+/**
+ * @brief Finds the entrances and distances of the clusters that have changed tiles again.
+ *
+ */
+void HierarchicalPathfinder::refresh()
+{
+	if (dirtyClusters.empty())
+		return;
+
+	//the nodes of an entrance are in two clusters, both of them need their distances found again
+	std::vector <int> changed = dirtyClusters;
+	for (int cluster : dirtyClusters)
+		for (int side = 0; side < 2; side++)
+		{
+			if (!clusters[cluster].borderDirty[side]) continue;
+			clusters[cluster].borderDirty[side] = false;
+			buildBorder(cluster, side);
+
+			int cx = cluster % clustersX, cy = cluster / clustersX;
+			int next = side == 0 ? cy * clustersX + (cx + 1) % clustersX : (cy + 1) % clustersY * clustersX + cx;
+			if (!clusters[next].dirty)
+			{
+				clusters[next].dirty = true;
+				changed.push_back(next);
+			}
+		}
+
+	for (int cluster : changed)
+	{
+		buildEdges(cluster, local);
+		clusters[cluster].dirty = false;
+	}
+	dirtyClusters.clear();
+}
+
+/**
+ * @brief Finds the entrances on the right or bottom edge of a cluster, to the next cluster. Every run of tiles that can be
+ * 		  left over the edge is an entrance, with a node on its middle tile and one on the tile next to it in the next cluster.
+ *
+ * @param cluster - The cluster
+ * @param side 	  - 0 for the right edge, 1 for the bottom edge
+ */
+void HierarchicalPathfinder::buildBorder(int cluster, int side)
+{
+	for (int node : clusters[cluster].borderNodes[side])
+	{
+		removeNode(nodes[node].partner);
+		removeNode(node);
+	}
+	clusters[cluster].borderNodes[side].clear();
+
+	int cx = cluster % clustersX, cy = cluster / clustersX;
+	int next = side == 0 ? cy * clustersX + (cx + 1) % clustersX : (cy + 1) % clustersY * clustersX + cx;
+	if (next == cluster)
+		return;	//one cluster wide, the edge leads back into the cluster
+
+	const Cluster& edge = clusters[cluster];
+	Direction direction = side == 0 ? right : down;
+	int length = side == 0 ? edge.height : edge.width;
+	auto tileAt = [&](int i)
+	{
+		return side == 0 ? m_Maze->getTileIndex(edge.left + edge.width - 1, edge.top + i)
+						 : m_Maze->getTileIndex(edge.left + i, edge.top + edge.height - 1);
+	};
+
+	for (int i = 0, runStart = -1; i <= length; i++)
+	{
+		bool open = i < length && m_Maze->canLeave(tileAt(i), direction);
+		if (open && runStart == -1)
+			runStart = i;
+		if (open || runStart == -1)
+			continue;
+
+		int tile = tileAt(runStart + (i - 1 - runStart) / 2);
+		int inside = addNode(tile, cluster),
+			outside = addNode(m_Maze->getNeighbour(tile, direction), next);
+		nodes[inside].partner = outside;
+		nodes[outside].partner = inside;
+		clusters[cluster].borderNodes[side].push_back(inside);
+		runStart = -1;
+	}
+}
+
+/**
+ * @brief Finds the distances between the nodes of a cluster, through the cluster only.
+ *
+ * @param cluster - The cluster
+ * @param search  - Where the searches are done
+ */
+void HierarchicalPathfinder::buildEdges(int cluster, ClusterSearch& search)
+{
+	const std::vector <int>& clusterNodes = clusters[cluster].nodes;
+	for (int node : clusterNodes)
+	{
+		searchCluster(cluster, nodes[node].tile, -1, search);
+
+		std::vector <AbstractEdge>& edges = nodes[node].edges;
+		edges.clear();
+		edges.push_back({ nodes[node].partner, 1 });
+		for (int other : clusterNodes)
+		{
+			int local = getLocalIndex(cluster, nodes[other].tile);
+			if (other != node && search.visit[local] == search.search)
+				edges.push_back({ other, search.distance[local] });
+		}
+	}
+}
+
+int HierarchicalPathfinder::addNode(int tile, int cluster)
+{
+	int node;
+	if (freeNodes.empty())
+	{
+		node = (int)nodes.size();
+		nodes.emplace_back();
+	}
+	else
+	{
+		node = freeNodes.back();
+		freeNodes.pop_back();
+	}
+
+	nodes[node].tile = tile;
+	nodes[node].cluster = cluster;
+	nodes[node].partner = -1;
+	nodes[node].edges.clear();
+	clusters[cluster].nodes.push_back(node);
+	return node;
+}
+
+void HierarchicalPathfinder::removeNode(int node)
+{
+	std::vector <int>& clusterNodes = clusters[nodes[node].cluster].nodes;
+	*std::find(clusterNodes.begin(), clusterNodes.end(), node) = clusterNodes.back();
+	clusterNodes.pop_back();
+
+	nodes[node].cluster = -1;
+	nodes[node].edges.clear();
+	freeNodes.push_back(node);
+}
+
+/**
+ * @brief Finds the cluster a tile is in.
+ *
+ * @param tile - The tile index
+ * @return The cluster
+ */
+int HierarchicalPathfinder::getClusterOfTile(int tile) const
+{
+	int x = tile % m_Maze->getWidth(), y = tile / m_Maze->getWidth();
+	return y / clusterSize * clustersX + x / clusterSize;
+}
+
+int HierarchicalPathfinder::getLocalIndex(int cluster, int tile) const
+{
+	const Cluster& inside = clusters[cluster];
+	int x = tile % m_Maze->getWidth(), y = tile / m_Maze->getWidth();
+	return (y - inside.top) * inside.width + (x - inside.left);
+}
+
+int HierarchicalPathfinder::getTileOfLocal(int cluster, int local) const
+{
+	const Cluster& inside = clusters[cluster];
+	return m_Maze->getTileIndex(inside.left + local % inside.width, inside.top + local / inside.width);
+}
+
+/**
+ * @brief Breadth first search from a tile, without leaving its cluster. Fills the distance and parent of the reached tiles,
+ * 		  as tiles of the cluster (see getLocalIndex()).
+ *
+ * @param cluster - The cluster of the tile
+ * @param from 	  - The tile the search starts from
+ * @param to 	  - The search stops when it reaches this tile, -1 to search the whole cluster
+ * @param search  - Where the search is done
+ * @return The distance to the tile to stop at, -1 if it was not reached
+ */
+int HierarchicalPathfinder::searchCluster(int cluster, int from, int to, ClusterSearch& search) const
+{
+	const Cluster& inside = clusters[cluster];
+	int width = inside.width, height = inside.height;
+	if (search.visit.size() < (size_t)width * height)
+	{
+		search.distance.resize((size_t)width * height);
+		search.parent.resize((size_t)width * height);
+		search.visit.resize((size_t)width * height, 0);
+	}
+
+	search.search++;
+	search.queue.clear();
+	int start = getLocalIndex(cluster, from),
+		target = to == -1 ? -1 : getLocalIndex(cluster, to);
+	search.queue.push_back(start % width | start / width << 16);	//the queue holds x and y, to save dividing for them
+	search.visit[start] = search.search;
+	search.distance[start] = 0;
+	search.parent[start] = -1;
+
+	//a cluster as wide or as high as the maze leads to its own opposite edge
+	bool wrapX = clustersX == 1, wrapY = clustersY == 1;
+	for (size_t head = 0; head < search.queue.size(); head++)
+	{
+		int x = search.queue[head] & 0xffff, y = search.queue[head] >> 16;
+		int current = y * width + x;
+		if (current == target)
+			return search.distance[current];
+
+		unsigned char exits = m_Maze->getExits(m_Maze->getTileIndex(inside.left + x, inside.top + y));
+		int nextX[4] = { x, x, x < width - 1 ? x + 1 : wrapX ? 0 : -1, x > 0 ? x - 1 : wrapX ? width - 1 : -1 },
+			nextY[4] = { y > 0 ? y - 1 : wrapY ? height - 1 : -1, y < height - 1 ? y + 1 : wrapY ? 0 : -1, y, y };
+		for (int d = 0; d < 4; d++)
+		{
+			if (!(exits >> d & 1) || nextX[d] == -1 || nextY[d] == -1)
+				continue;
+			int neighbour = nextY[d] * width + nextX[d];
+			if (search.visit[neighbour] == search.search)
+				continue;
+			search.visit[neighbour] = search.search;
+			search.distance[neighbour] = search.distance[current] + 1;
+			search.parent[neighbour] = current;
+			search.queue.push_back(nextX[d] | nextY[d] << 16);
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief The least amount of steps between two tiles, over the edges of the maze as well.
+ *
+ * @param from - A tile index
+ * @param to   - A tile index
+ * @return The amount of steps
+ */
+int HierarchicalPathfinder::estimate(int from, int to) const
+{
+	int width = m_Maze->getWidth(), height = m_Maze->getHeight();
+	int dx = std::abs(from % width - to % width),
+		dy = std::abs(from / width - to / width);
+	return std::min(dx, width - dx) + std::min(dy, height - dy);
+}
+
+/**
+ * @brief Finds a path through the entrances between two tiles, with A* over the graph of the entrances. The clusters
+ * 		  of the start and the goal are searched to connect them to the graph, nothing else of the maze is.
+ * 		  The tiles of the path are found while it is followed, see nextTile().
+ *
+ * @param start - The tile index the path starts on
+ * @param goal 	- The tile index the path ends on
+ * @param path 	- Replaced with the path
+ * @return true if there is a path
+ */
+bool HierarchicalPathfinder::findPath(int start, int goal, HierarchicalPath& path)
+{
+	refresh();
+	path.waypoints.clear();
+	path.steps.clear();
+	path.nextWaypoint = 0;
+	path.position = start;
+	path.goal = goal;
+	path.length = 0;
+	if (!m_Maze->isWalkable(start) || !m_Maze->isWalkable(goal))
+		return false;
+
+	int startCluster = getClusterOfTile(start),
+		goalCluster = getClusterOfTile(goal);
+	if (startCluster == goalCluster)
+	{
+		int distance = searchCluster(startCluster, start, goal, local);
+		if (distance != -1)
+		{
+			path.waypoints.push_back(goal);
+			path.length = distance;
+			return true;
+		}
+	}
+
+	if (nodeCost.size() < nodes.size())
+	{
+		nodeCost.resize(nodes.size());
+		nodeParent.resize(nodes.size());
+		nodeVisit.resize(nodes.size(), 0);
+		goalCost.resize(nodes.size(), -1);
+	}
+	nodeSearch++;
+
+	//the nodes of the goal's cluster, with their distance to the goal
+	searchCluster(goalCluster, goal, -1, local);
+	goalNodes.clear();
+	for (int node : clusters[goalCluster].nodes)
+	{
+		int tile = getLocalIndex(goalCluster, nodes[node].tile);
+		if (local.visit[tile] == local.search)
+		{
+			goalCost[node] = local.distance[tile];
+			goalNodes.push_back(node);
+		}
+	}
+
+	//an open list of (estimated length, -length so far, node), the shortest first, and of those the one closest to the goal
+	typedef std::tuple<int, int, int> OpenNode;
+	std::vector <OpenNode> open;
+	searchCluster(startCluster, start, -1, local);
+	for (int node : clusters[startCluster].nodes)
+	{
+		int tile = getLocalIndex(startCluster, nodes[node].tile);
+		if (local.visit[tile] != local.search)
+			continue;
+		nodeVisit[node] = nodeSearch;
+		nodeCost[node] = local.distance[tile];
+		nodeParent[node] = -1;
+		open.push_back(OpenNode(nodeCost[node] + estimate(nodes[node].tile, goal), -nodeCost[node], node));
+	}
+	std::make_heap(open.begin(), open.end(), std::greater<OpenNode>());
+
+	int best = INT_MAX, bestNode = -1;
+	while (!open.empty())
+	{
+		std::pop_heap(open.begin(), open.end(), std::greater<OpenNode>());
+		int estimated, cost, node;
+		std::tie(estimated, cost, node) = open.back();
+		open.pop_back();
+		cost = -cost;
+		if (estimated >= best)
+			break;
+		if (cost != nodeCost[node])
+			continue;	//found shorter since it was added
+
+		if (goalCost[node] != -1 && cost + goalCost[node] < best)
+		{
+			best = cost + goalCost[node];
+			bestNode = node;
+		}
+		for (const AbstractEdge& edge : nodes[node].edges)
+		{
+			int next = cost + edge.cost;
+			if (nodeVisit[edge.to] == nodeSearch && nodeCost[edge.to] <= next)
+				continue;
+			nodeVisit[edge.to] = nodeSearch;
+			nodeCost[edge.to] = next;
+			nodeParent[edge.to] = node;
+			open.push_back(OpenNode(next + estimate(nodes[edge.to].tile, goal), -next, edge.to));
+			std::push_heap(open.begin(), open.end(), std::greater<OpenNode>());
+		}
+	}
+
+	for (int node : goalNodes)
+		goalCost[node] = -1;
+	if (bestNode == -1)
+		return false;
+
+	for (int node = bestNode; node != -1; node = nodeParent[node])
+		path.waypoints.push_back(nodes[node].tile);
+	std::reverse(path.waypoints.begin(), path.waypoints.end());
+	path.waypoints.push_back(goal);
+	path.length = best;
+	return true;
+}
+
+/**
+ * @brief Finds the tiles from where the path is to its next waypoint, which is in the same cluster or just over an entrance.
+ *
+ * @param path - The path, with no steps left
+ * @return false if the tiles have changed, and the waypoint can not be reached anymore
+ */
+bool HierarchicalPathfinder::refine(HierarchicalPath& path)
+{
+	int from = path.position,
+		to = path.waypoints[path.nextWaypoint++];
+	if (from == to)
+		return true;
+
+	int cluster = getClusterOfTile(from);
+	if (cluster != getClusterOfTile(to))
+	{
+		for (int d = 0; d < 4; d++)
+			if (m_Maze->getNeighbour(from, (Direction)d) == to)
+			{
+				path.steps.push_back(to);
+				return true;
+			}
+		return false;
+	}
+
+	if (searchCluster(cluster, from, to, local) == -1)
+		return false;
+	for (int tile = getLocalIndex(cluster, to); local.parent[tile] != -1; tile = local.parent[tile])
+		path.steps.push_back(getTileOfLocal(cluster, tile));
+	return true;
+}
+
+/**
+ * @brief Follows a path. The actor does not have to ask on every tile: the tiles it has passed since the last time are skipped.
+ *
+ * @param path - The path
+ * @param tile - The tile index the actor is on
+ * @return The tile to go to next, -1 if the goal is reached or the actor is not on the path anymore
+ */
+int HierarchicalPathfinder::nextTile(HierarchicalPath& path, int tile)
+{
+	refresh();
+	for (int stretches = 0; tile != path.position; stretches++)
+	{
+		std::vector <int>::iterator passed = std::find(path.steps.begin(), path.steps.end(), tile);
+		if (passed != path.steps.end())
+		{
+			path.steps.erase(passed, path.steps.end());
+			path.position = tile;
+			break;
+		}
+
+		//the actor may have gone past the next waypoint, but not much further without asking
+		if (!path.steps.empty())
+		{
+			path.position = path.steps.front();
+			path.steps.clear();
+		}
+		if (stretches == 2 || path.nextWaypoint >= path.waypoints.size() || !refine(path))
+			return -1;
+	}
+
+	while (path.steps.empty())
+		if (path.nextWaypoint >= path.waypoints.size() || !refine(path))
+			return -1;
+	return path.steps.back();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file HierarchicalPathfinder.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the HierarchicalPathfinder class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+
+#include <vector>
+
+/**
+ * @brief A path found by the HierarchicalPathfinder. Only the entrances it goes through are found at first,
+ * 		  the tiles between them are found one stretch at a time while the path is followed (see HierarchicalPathfinder::nextTile()).
+ *
+ */
+struct HierarchicalPath
+{
+	std::vector <int> waypoints;	//the start, the entrances between the clusters and the goal, as tiles
+	std::vector <int> steps;		//the tiles to the next waypoint, the next tile last
+	size_t			  nextWaypoint = 0;
+	int				  position = -1,	//the tile the path was last followed to
+					  goal = -1,
+					  length = 0;		//in steps, from the start to the goal
+
+	bool isDone() const { return steps.empty() && nextWaypoint >= waypoints.size(); }
+};
+
+/**
+ * @class HierarchicalPathfinder
+ * @brief Finds paths through huge mazes without searching the maze itself (HPA*). The maze is split into square clusters,
+ * 		  and every corridor between two clusters is an entrance, with a node on both sides of it. The distances between
+ * 		  the nodes of a cluster are found once, which makes the clusters and entrances a small graph that is searched
+ * 		  instead of the maze: a path only searches the clusters of its start and goal, and the graph in between.
+ * 		  When tiles change (see updateTile()) only the clusters around them are found again, before the next path.
+ * 		  The paths are a little longer than the shortest ones, as they go through the middle of the entrances.
+ */
+class HierarchicalPathfinder
+{
+private:
+	struct AbstractEdge
+	{
+		int to,
+			cost;
+	};
+
+	struct AbstractNode
+	{
+		int tile,
+			cluster,
+			partner;			//the node on the other side of the entrance
+		std::vector <AbstractEdge> edges;
+	};
+
+	//a breadth first search inside a cluster, on the tiles of the cluster numbered from its top left
+	struct ClusterSearch
+	{
+		std::vector <int> distance,	//valid when visit is the current search
+						  parent,
+						  visit,
+						  queue;
+		int				  search = 0;
+	};
+
+	struct Cluster
+	{
+		int left,
+			top,
+			width,
+			height;
+		std::vector <int> nodes;
+		std::vector <int> borderNodes[2];	//the nodes on the right and the bottom edge, with their partners in the next clusters
+		bool borderDirty[2],
+			 dirty;
+	};
+
+	const Maze*				   m_Maze;
+	int						   clusterSize,
+							   clustersX,
+							   clustersY;
+	std::vector <Cluster>	   clusters;
+	std::vector <AbstractNode> nodes;
+	std::vector <int>		   freeNodes;		//removed nodes, reused by the next entrances
+	std::vector <int>		   dirtyClusters;
+
+	//the searches, kept between them so that nothing is allocated per path
+	ClusterSearch			   local;
+	std::vector <int>		   nodeCost,		//per node, valid when nodeVisit is the current search
+							   nodeParent,
+							   nodeVisit,
+							   goalCost;		//per node, the distance to the goal inside the goal's cluster, -1 for none
+	std::vector <int>		   goalNodes;
+	int						   nodeSearch;
+public:
+	HierarchicalPathfinder(const Maze* maze, int clusterSize = 32);
+
+	void build(int threads = 0);
+	void updateTile(int tile);
+	bool findPath(int start, int goal, HierarchicalPath& path);
+	int  nextTile(HierarchicalPath& path, int tile);
+
+	int getClusterSize() const { return clusterSize; }
+	int getClusterCount() const { return (int)clusters.size(); }
+	int getClusterOfTile(int tile) const;
+	int getNodeCount() const { return (int)(nodes.size() - freeNodes.size()); }
+
+private:
+	void refresh();
+	void buildBorder(int cluster, int side);
+	void buildEdges(int cluster, ClusterSearch& search);
+	int  addNode(int tile, int cluster);
+	void removeNode(int node);
+	int  searchCluster(int cluster, int from, int to, ClusterSearch& search) const;
+	int  getLocalIndex(int cluster, int tile) const;
+	int  getTileOfLocal(int cluster, int local) const;
+	int  estimate(int from, int to) const;
+	bool refine(HierarchicalPath& path);
+};
@@ -10,21 +10,23 @@
  */
 #include "IndexBuffer.h"
 #include <iostream>
+#include <vector>
 
 #include <GL/glew.h>
 
 /**
  * @brief Construct a new Index Buffer:: Index Buffer object
  * 
- * @param data 	- The data to be sent to the buffer
- * @param count - The amount of elements, not the total size in bytes.
+ * @param data 		  - The data to be sent to the buffer
+ * @param count 	  - The amount of elements, not the total size in bytes.
+ * @param vertexCount - The amount of vertices the indices refer to, decides the size of each index.
  */
-IndexBuffer::IndexBuffer(const void* data, unsigned int count)
-	: m_count(count)
+IndexBuffer::IndexBuffer(const unsigned int* data, unsigned int count, unsigned int vertexCount)
+	: m_count(count),
+	  m_type(getTypeForVertexCount(vertexCount))
 {
 	glGenBuffers(1, &renderer_ID);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, renderer_ID);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW);
+	uploadIndices(data, count);
 }
 
 /**
@@ -55,15 +57,57 @@ void IndexBuffer::Unbind() const
 }
 
 /**
- * @brief Updates the buffer with a new set of data
+ * @brief Updates the buffer with a new set of data, the indices must fit the index type chosen when the buffer was made.
  * 
  * @param data	- The data to be sent to the buffer
  * @param count - The amount of elements, not the total size in bytes. 
  */
 void IndexBuffer::selectIndices(const unsigned int* data, unsigned int count)
+{
+	m_count = count;
+	uploadIndices(data, count);
+}
+
+/**
+ * @brief Narrows the indices to the buffer's index size and sends them to the buffer.
+ * 
+ * @param data	- The indices
+ * @param count - The amount of indices
+ */
+void IndexBuffer::uploadIndices(const unsigned int* data, unsigned int count)
 {
 	Bind();
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW);
+	switch (m_type)
+	{
+	case GL_UNSIGNED_BYTE:
+	{
+		std::vector <unsigned char> narrow(data, data + count);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned char), narrow.data(), GL_STATIC_DRAW);
+		break;
+	}
+	case GL_UNSIGNED_SHORT:
+	{
+		std::vector <unsigned short> narrow(data, data + count);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned short), narrow.data(), GL_STATIC_DRAW);
+		break;
+	}
+	default:
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW);
+		break;
+	}
+}
+
+/**
+ * @brief Finds the smallest index type that can refer to every vertex.
+ * 
+ * @param vertexCount - The amount of vertices
+ * @return GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+ */
+unsigned int IndexBuffer::getTypeForVertexCount(unsigned int vertexCount)
+{
+	if (vertexCount <= 256)		return GL_UNSIGNED_BYTE;
+	if (vertexCount <= 65536)	return GL_UNSIGNED_SHORT;
+	return GL_UNSIGNED_INT;
 }
 
 /**
@@ -12,15 +12,17 @@
 
 /**
  * @class IndexBuffer
- * @brief Boilerplate OpenGL code regarding Element Array Buffers
+ * @brief Boilerplate OpenGL code regarding Element Array Buffers.
+ * 		  The indices are stored as 8, 16 or 32 bit, the smallest that fits the amount of vertices.
  */
 class IndexBuffer
 {
 private:
 	unsigned int renderer_ID;
 	unsigned int m_count;
+	unsigned int m_type;
 public:
-	IndexBuffer(const void* data, unsigned int count);
+	IndexBuffer(const unsigned int* data, unsigned int count, unsigned int vertexCount);
 	~IndexBuffer();
 
 	void Bind() const;
@@ -30,5 +32,9 @@ public:
 
 	void deleteBuffer();
 	inline unsigned int getCount() const { return m_count; }
-};
+	inline unsigned int getType() const { return m_type; }
 
+	static unsigned int getTypeForVertexCount(unsigned int vertexCount);
+private:
+	void uploadIndices(const unsigned int* data, unsigned int count);
+};
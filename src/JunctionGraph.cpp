@@ -0,0 +1,245 @@
+/**
+ * @file JunctionGraph.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the JunctionGraph class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "JunctionGraph.h"
+
+#include <algorithm>
+#include <bitset>
+
+/**
+ * @brief Construct a new Junction Graph:: Junction Graph object, and builds the graph.
+ *
+ * @param maze - The maze the graph is made from
+ */
+JunctionGraph::JunctionGraph(Maze* maze)
+	: m_Maze(maze)
+{
+	build();
+}
+
+/**
+ * @brief (Re)builds the graph from the exits of the tiles. Every walkable tile that does not have
+ * 		  exactly two exits is a node, the corridors are followed from every node until they reach another node.
+ */
+void JunctionGraph::build()
+{
+	int tiles = m_Maze->getWidth() * m_Maze->getHeight();
+	nodes.clear(); edges.clear(); edgeTiles.clear();
+	unusedEdgeTiles = 0;
+	nodeOfTile.assign(tiles, -1);
+	edgeOfTile.assign(tiles, -1);
+
+	for (int tile = 0; tile < tiles; tile++)
+		if (m_Maze->isWalkable(tile) && std::bitset<4>(m_Maze->getExits(tile)).count() != 2)
+			addNode(tile);
+
+	for (int node = 0; node < getNodeCount(); node++)
+		addEdges(node);
+
+	//corridors that are not reached from any node are loops, they get a node of their own
+	for (int tile = 0; tile < tiles; tile++)
+		if (m_Maze->isWalkable(tile) && nodeOfTile[tile] == -1 && edgeOfTile[tile] == -1)
+			addEdges(addNode(tile));
+}
+
+/**
+ * @brief Adds a node, without any edges yet.
+ *
+ * @param tile - The tile of the node
+ * @return The index of the node
+ */
+int JunctionGraph::addNode(int tile)
+{
+	nodeOfTile[tile] = (int)nodes.size();
+	nodes.push_back({ tile, { -1, -1, -1, -1 } });
+	return nodeOfTile[tile];
+}
+
+/**
+ * @brief Follows the corridor leaving a node in every direction that has no edge yet, around the corners, until it reaches a node.
+ *
+ * @param node - The node the edges start at
+ */
+void JunctionGraph::addEdges(int node)
+{
+	for (int d = 0; d < 4; d++)
+	{
+		Direction direction = (Direction)d;
+		if (!m_Maze->canLeave(nodes[node].tile, direction) || nodes[node].edges[d] != -1) continue;
+
+		JunctionEdge edge;
+		edge.from = node;
+		edge.startDirection = direction;
+		edge.firstTile = (int)edgeTiles.size();
+		edge.length = 1;
+
+		int index = (int)edges.size();
+		int tile = m_Maze->getNeighbour(nodes[node].tile, direction);
+		while (nodeOfTile[tile] == -1)
+		{
+			edgeTiles.push_back(tile);
+			if (edgeOfTile[tile] == -1) edgeOfTile[tile] = index;
+
+			//a corridor tile has two exits, the one that is not back where we came from
+			int exits = m_Maze->getExits(tile) & ~(1 << opposite(direction));
+			direction = (Direction)(exits & 1 ? up : exits & 2 ? down : exits & 4 ? right : left);
+			tile = m_Maze->getNeighbour(tile, direction);
+			edge.length++;
+		}
+		edge.to = nodeOfTile[tile];
+		edge.endDirection = direction;
+
+		nodes[node].edges[d] = index;
+		edges.push_back(edge);
+	}
+}
+
+/**
+ * @brief Updates the graph after Maze::setTile() has changed a tile. Only the corridors through the tile and its
+ * 		  four neighbours are followed again, so the cost depends on the length of those corridors, not the size of the maze.
+ * 		  Node and edge indices can change, as removed ones are replaced by the last ones.
+ * 		  A node that was made for a loop can stay when the loop gets an intersection, it is then a node with two exits.
+ *
+ * @param tile - The tile that changed
+ */
+void JunctionGraph::updateTile(int tile)
+{
+	int width = m_Maze->getWidth(), height = m_Maze->getHeight(),
+		x = tile % width, y = tile / width;
+	const int touched[5] = { tile, ((y + height - 1) % height) * width + x, ((y + 1) % height) * width + x,
+							 y * width + (x + 1) % width, y * width + (x + width - 1) % width };
+
+	//every edge through the tiles whose exits changed, in both directions
+	std::vector <int> removed;
+	for (int t : touched)
+	{
+		if (nodeOfTile[t] != -1)
+		{
+			for (int d = 0; d < 4; d++)
+				if (nodes[nodeOfTile[t]].edges[d] != -1)
+				{
+					removed.push_back(nodes[nodeOfTile[t]].edges[d]);
+					removed.push_back(getReverseEdge(nodes[nodeOfTile[t]].edges[d]));
+				}
+		}
+		else if (edgeOfTile[t] != -1)
+		{
+			removed.push_back(edgeOfTile[t]);
+			removed.push_back(getReverseEdge(edgeOfTile[t]));
+		}
+	}
+	std::sort(removed.begin(), removed.end());
+	removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+
+	//the nodes and tiles that have to be connected again, by tile as the indices change
+	std::vector <int> retrace(touched, touched + 5), freed(touched, touched + 5);
+	for (int edge : removed)
+	{
+		retrace.push_back(nodes[edges[edge].from].tile);
+		retrace.push_back(nodes[edges[edge].to].tile);
+		freed.insert(freed.end(), getEdgeTiles(edge), getEdgeTiles(edge) + edges[edge].length - 1);
+	}
+
+	for (int i = (int)removed.size() - 1; i >= 0; i--)	//from the last, so the edges that are moved are never removed ones
+		removeEdge(removed[i]);
+
+	for (int t : touched)
+	{
+		bool junction = m_Maze->isWalkable(t) && std::bitset<4>(m_Maze->getExits(t)).count() != 2;
+		if (nodeOfTile[t] != -1 && !junction)
+			removeNode(nodeOfTile[t]);
+		else if (nodeOfTile[t] == -1 && junction)
+			addNode(t);
+	}
+
+	for (int t : retrace)
+		if (nodeOfTile[t] != -1)
+			addEdges(nodeOfTile[t]);
+
+	//a corridor that is left without a node is a loop, as in build()
+	for (int t : freed)
+		if (m_Maze->isWalkable(t) && nodeOfTile[t] == -1 && edgeOfTile[t] == -1)
+			addEdges(addNode(t));
+
+	if (unusedEdgeTiles > edgeTiles.size() / 2)
+		compactEdgeTiles();
+}
+
+/**
+ * @brief Removes a node without edges, moving the last node into its place.
+ *
+ * @param node - The node
+ */
+void JunctionGraph::removeNode(int node)
+{
+	int last = getNodeCount() - 1;
+	nodeOfTile[nodes[node].tile] = -1;
+	if (node != last)
+	{
+		nodes[node] = nodes[last];
+		nodeOfTile[nodes[node].tile] = node;
+		for (int d = 0; d < 4; d++)
+		{
+			int edge = nodes[node].edges[d];
+			if (edge == -1) continue;
+			edges[edge].from = node;
+			if (edges[edge].to == last)	//a loop back to the node itself
+				edges[edge].to = node;
+			else
+				edges[getReverseEdge(edge)].to = node;
+		}
+	}
+	nodes.pop_back();
+}
+
+/**
+ * @brief Removes an edge, moving the last edge into its place. Its tiles stay in the tile list until it is compacted.
+ *
+ * @param edge - The edge
+ */
+void JunctionGraph::removeEdge(int edge)
+{
+	const int* tiles = getEdgeTiles(edge);
+	for (int i = 0; i < edges[edge].length - 1; i++)
+		if (edgeOfTile[tiles[i]] == edge)
+			edgeOfTile[tiles[i]] = -1;
+	nodes[edges[edge].from].edges[edges[edge].startDirection] = -1;
+	unusedEdgeTiles += edges[edge].length - 1;
+
+	int last = getEdgeCount() - 1;
+	if (edge != last)
+	{
+		edges[edge] = edges[last];
+		nodes[edges[edge].from].edges[edges[edge].startDirection] = edge;
+		tiles = getEdgeTiles(edge);
+		for (int i = 0; i < edges[edge].length - 1; i++)
+			if (edgeOfTile[tiles[i]] == last)
+				edgeOfTile[tiles[i]] = edge;
+	}
+	edges.pop_back();
+}
+
+/**
+ * @brief Drops the tiles of removed edges from the tile list.
+ *
+ */
+void JunctionGraph::compactEdgeTiles()
+{
+	std::vector <int> compacted;
+	compacted.reserve(edgeTiles.size() - unusedEdgeTiles);
+	for (int edge = 0; edge < getEdgeCount(); edge++)
+	{
+		int first = (int)compacted.size();
+		compacted.insert(compacted.end(), getEdgeTiles(edge), getEdgeTiles(edge) + edges[edge].length - 1);
+		edges[edge].firstTile = first;
+	}
+	edgeTiles.swap(compacted);
+	unusedEdgeTiles = 0;
+}
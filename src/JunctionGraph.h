@@ -0,0 +1,80 @@
+/**
+ * @file JunctionGraph.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the JunctionGraph class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "Maze.h"
+
+#include <vector>
+
+/**
+ * @brief An intersection or dead end in the maze.
+ *
+ */
+struct JunctionNode
+{
+	int tile;
+	int edges[4];	//the edge leaving in each direction, -1 for none
+};
+
+/**
+ * @brief A corridor between two nodes, in one direction. Every corridor has an edge in each direction.
+ *
+ */
+struct JunctionEdge
+{
+	int			from,
+				to;
+	Direction	startDirection,		//the direction the edge leaves its first node in
+				endDirection;		//the direction the edge enters its last node in, after the corners
+	int			length,				//in tiles, the amount of steps from node to node
+				firstTile;			//where the tiles between the nodes start in the tile list, there are length - 1 of them
+};
+
+/**
+ * @class JunctionGraph
+ * @brief The maze compiled into a graph, with the intersections and dead ends as nodes and the corridors
+ * 		  between them as edges. Searches and AI decisions work on the graph, which is much smaller than the maze.
+ * 		  A loop of corridor without any intersection gets one of its tiles as a node.
+ */
+class JunctionGraph
+{
+private:
+	Maze* m_Maze;
+
+	std::vector <JunctionNode> nodes;
+	std::vector <JunctionEdge> edges;
+	std::vector <int>		   edgeTiles;	//the tiles between the nodes, edge by edge
+
+	std::vector <int>		   nodeOfTile,	//per tile, the node on it or -1
+							   edgeOfTile;	//per tile, an edge passing through it or -1
+	size_t					   unusedEdgeTiles;	//left in edgeTiles by removed edges, see updateTile()
+public:
+	JunctionGraph(Maze* maze);
+
+	void build();
+	void updateTile(int tile);
+
+	int getNodeCount() const { return (int)nodes.size(); }
+	int getEdgeCount() const { return (int)edges.size(); }
+	const JunctionNode& getNode(int node) const { return nodes[node]; }
+	const JunctionEdge& getEdge(int edge) const { return edges[edge]; }
+	const int* getEdgeTiles(int edge) const { return edgeTiles.data() + edges[edge].firstTile; }
+	int getReverseEdge(int edge) const { return nodes[edges[edge].to].edges[opposite(edges[edge].endDirection)]; }
+
+	int getNodeOfTile(int tile) const { return nodeOfTile[tile]; }
+	int getEdgeOfTile(int tile) const { return edgeOfTile[tile]; }
+
+private:
+	int  addNode(int tile);
+	void addEdges(int node);
+	void removeNode(int node);
+	void removeEdge(int edge);
+	void compactEdgeTiles();
+};
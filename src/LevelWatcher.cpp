@@ -0,0 +1,176 @@
+/**
+ * @file LevelWatcher.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the LevelWatcher class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "LevelWatcher.h"
+#include "ScenarioLoader.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Construct a new Level Watcher:: Level Watcher object, and starts watching the file.
+ *
+ * @param path 	 - The level file
+ * @param width  - The width of the level, a file saved with another size is not loaded
+ * @param height - The height of the level
+ * @param tiles  - The level file as it was read when the level was loaded
+ */
+LevelWatcher::LevelWatcher(const std::string& path, int width, int height, const std::vector <int>& tiles)
+	: path(path),
+	  width(width),
+	  height(height),
+	  tiles(tiles),
+	  quitting(false),
+	  inotify(-1),
+	  hasPending(false)
+{
+	std::filesystem::path file(path);
+	directory = file.has_parent_path() ? file.parent_path().string() : ".";
+	fileName = file.filename().string();
+	std::error_code error;
+	written = std::filesystem::last_write_time(path, error);
+
+#ifdef __linux__
+	//the directory is watched, as many editors save by writing a new file and renaming it
+	inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotify != -1 && inotify_add_watch(inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+	{
+		close(inotify);
+		inotify = -1;
+	}
+#endif
+
+	worker = std::thread(&LevelWatcher::watch, this);
+}
+
+/**
+ * @brief Destroy the Level Watcher:: Level Watcher object, after its thread has stopped.
+ *
+ */
+LevelWatcher::~LevelWatcher()
+{
+	quitting = true;
+	worker.join();
+#ifdef __linux__
+	if (inotify != -1)
+		close(inotify);
+#endif
+}
+
+/**
+ * @brief Takes the tiles that have changed in the file, once per frame. Does not wait for the watcher's thread.
+ *
+ * @param changes - Cleared, and filled with the changes
+ * @return true if there were any
+ */
+bool LevelWatcher::takeChanges(std::vector <TileChange>& changes)
+{
+	changes.clear();
+	if (!hasPending.load(std::memory_order_acquire))
+		return false;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	changes.swap(pending);
+	hasPending = false;
+	return !changes.empty();
+}
+
+/**
+ * @brief The loop of the watcher's thread.
+ *
+ */
+void LevelWatcher::watch()
+{
+	while (!quitting)
+		if (waitForChange())
+			reload();
+}
+
+/**
+ * @brief Waits a little while for the file to be saved.
+ *
+ * @return true if it was saved
+ */
+bool LevelWatcher::waitForChange()
+{
+	const int waitMs = 100;	//how long the destructor may have to wait for the thread
+#ifdef __linux__
+	if (inotify != -1)
+	{
+		pollfd events = { inotify, POLLIN, 0 };
+		if (poll(&events, 1, waitMs) <= 0)
+			return false;
+
+		bool saved = false;
+		alignas(inotify_event) char buffer[4096];
+		ssize_t length;
+		while ((length = read(inotify, buffer, sizeof(buffer))) > 0)
+			for (char* next = buffer; next < buffer + length; )
+			{
+				const inotify_event* event = (const inotify_event*)next;
+				if (event->len && fileName == event->name)
+					saved = true;
+				next += sizeof(inotify_event) + event->len;
+			}
+		return saved;
+	}
+#endif
+
+	//compared with the time seen by the last call, so that a save between two calls is not missed
+	std::this_thread::sleep_for(std::chrono::milliseconds(waitMs));
+	std::error_code error;
+	std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+	if (error || time == written)
+		return false;
+	written = time;
+	return true;
+}
+
+/**
+ * @brief Reads the file again, and queues the tiles that changed for the game.
+ *
+ */
+void LevelWatcher::reload()
+{
+	if (!std::ifstream(path))
+		return;
+
+	ScenarioLoader loaded(path);
+	if (!loaded.isComplete())	//read while it was being written, it is read again when the writing is done
+		return;
+	if (loaded.getHorizontalSize() != width || loaded.getVerticalSize() != height)
+	{
+		std::cout << "Warning: " << path << " does not have the size of the level (" << width << 'x' << height
+				  << "), restart the game to load it\n";
+		return;
+	}
+
+	std::vector <TileChange> changes;
+	for (int i = 0; i < width * height; i++)
+		if (loaded.mazeMap[i] != tiles[i])
+		{
+			tiles[i] = loaded.mazeMap[i];
+			changes.push_back({ i % width, i / width, tiles[i] });
+		}
+	if (changes.empty())
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	pending.insert(pending.end(), changes.begin(), changes.end());
+	hasPending.store(true, std::memory_order_release);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file LevelWatcher.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the LevelWatcher class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A tile that is different in the level file since it was last read.
+ *
+ */
+struct TileChange
+{
+	int x,
+		y,
+		value;	//the value in the level file
+};
+
+/**
+ * @class LevelWatcher
+ * @brief Watches a level file while it is played, for editing levels without restarting the game.
+ * 		  When the file is saved it is read again on the watcher's thread, and the tiles that are different
+ * 		  from the last time it was read are handed to the game, which changes only those (see CampaignLevel::setTile()).
+ * 		  The file is compared with itself and not with the Maze, so the pellets that have been eaten stay eaten.
+ * 		  On Linux the file's directory is watched with inotify, elsewhere the time the file was written is checked.
+ */
+class LevelWatcher
+{
+private:
+	std::string		   path,
+					   directory,
+					   fileName;
+	int				   width,
+					   height;
+	std::vector <int>  tiles;		//the level file as it was last read, only used by the thread after the constructor
+
+	std::thread		   worker;
+	std::atomic<bool>  quitting;
+	int				   inotify;		//the inotify instance, -1 when polling
+	std::filesystem::file_time_type written;	//when the file was written, as last seen while polling
+
+	std::mutex		   mutex;
+	std::vector <TileChange> pending;	//the changes the game has not taken yet
+	std::atomic<bool>  hasPending;
+public:
+	LevelWatcher(const std::string& path, int width, int height, const std::vector <int>& tiles);
+	~LevelWatcher();
+
+	bool takeChanges(std::vector <TileChange>& changes);
+
+private:
+	void watch();
+	bool waitForChange();
+	void reload();
+};
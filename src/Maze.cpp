@@ -11,144 +11,226 @@
 #include "Maze.h"
 #include "ScenarioLoader.h"
 
-#include "VertexBuffer.h"
-#include "IndexBuffer.h"
-#include "VertexArray.h"
-#include "Renderer.h"
-
+#include <algorithm>
 #include <iostream>
 
 /**
  * @brief Construct a new Maze:: Maze object
  * 
  * @param loadedLevel - A ScenarioLoader containing the level file
- * @param shader 	  - The maze's shader
- * @param renderer 	  - The maze's renderer
  * 
- * @see	make2dArray();
- * @see	generateMaze();
+ * @see	analyze();
  */
-Maze::Maze(ScenarioLoader* loadedLevel, Shader* shader, Renderer* renderer)
+Maze::Maze(ScenarioLoader* loadedLevel)
 	: m_LoadedLevel(loadedLevel),
-	  m_Renderer(renderer),
-	  m_Shader(shader),
 	  pelletCount(0)
 {
 	width = m_LoadedLevel->getHorizontalSize();
 	height = m_LoadedLevel->getVerticalSize();
 
 	map2d.resize(height, std::vector<int>(width));
-	make2dArray();
-	generateMaze();
-	countPellets();
-}
-
-/**
- * @brief Destroy the Maze:: Maze object
- * 
- */
-Maze::~Maze(){
-	free(mazeVAO);
-	free(mazeVBO);
-	free(mazeVBLayout);
-	free(mazeIBO);
+	analyze();
+	bitboard.build(map2d);
+	pelletCount = tileCounts[pelletTile] + tileCounts[spawnTile];	//the spawns get pellets, see takeSpawns()
+	buildAdjacency();
 }
 
 /**
- * @brief Converts the 1D vector of the map from the ScenarioLoader into a 2D vector. 
+ * @brief Converts the 1D vector of the map from the ScenarioLoader into a 2D vector, and in the same pass
+ * 		  lists the spawns and the pellets and counts the tiles of every type.
  * 
  */
-void Maze::make2dArray()
+void Maze::analyze()
 {
+	for (int type = 0; type < tileTypes; type++)
+		tileCounts[type] = 0;
+	spawns.clear();
+	pelletTiles.clear();
+	pelletListed.assign((size_t)width * height, 0);
+
+	pelletTiles.reserve((size_t)width * height / 2);	//about half the tiles of a maze are corridors
+	const int* level = m_LoadedLevel->mazeMap.data();
 	int index = 0;
 	for (int i = 0; i < height; i++)
 	{
-		for (int j = 0; j < width; j++)
+		int* row = map2d[i].data();
+		for (int j = 0; j < width; j++, index++)
 		{
-			map2d[i][j] = m_LoadedLevel->mazeMap[index++];
+			int value = row[j] = level[index];
+			if (value == 1)
+				tileCounts[wallTile]++;
+			else if (value == 0)
+			{
+				pelletListed[index] = 1;
+				pelletTiles.push_back(index);
+			}
+			else if (value >= 2)
+				spawns.push_back({ value, index });
 		}
 	}
+	tileCounts[pelletTile] = (int)pelletTiles.size();
+	tileCounts[spawnTile] = (int)spawns.size();
+
+	//only the spawns are sorted, a few of them on even the largest levels
+	spawnsByCode.resize(spawns.size());
+	for (size_t i = 0; i < spawns.size(); i++)
+		spawnsByCode[i] = (int)i;
+	std::stable_sort(spawnsByCode.begin(), spawnsByCode.end(),
+		[&](int a, int b) { return spawns[a].code < spawns[b].code; });
 }
 
 /**
- * @brief Generates the indices for each square in the maze.
+ * @brief Adds a tile to the pellet tiles, unless it is there already.
  * 
+ * @param tile - The tile index
  */
-void Maze::makeIndices()
+void Maze::listPellet(int tile)
 {
-	//Since we require +1 more indices than the amount of squares it is incremented.
-	int indicesHeigth = height + 1; int indicesWidth = width + 1;
-
-	for (int i = 0; i < indicesHeigth; i++) {
-		for (int j = 0; j < indicesWidth; j++) {
-			if (i < map2d.size() && j < map2d[i].size() && map2d[i][j] == 1) {
-						mazeIndices.push_back((i * indicesWidth) + j);
-						mazeIndices.push_back((i * indicesWidth) + j + 1);
-						mazeIndices.push_back(((i + 1) * indicesWidth) + j);
-
-						mazeIndices.push_back((i * indicesWidth) + j + 1);
-						mazeIndices.push_back(((i + 1) * indicesWidth) + j);
-						mazeIndices.push_back(((i + 1) * indicesWidth) + (j + 1));
-			}
-		}
-	}
+	if (pelletListed[tile]) return;
+	pelletListed[tile] = 1;
+	pelletTiles.push_back(tile);
 }
 
 /**
- * @brief Generates positions to be used by the squares.
+ * @brief Finds the spawn with a code, such as 2 for Pacman.
  * 
+ * @param code - The tile's value in the level file
+ * @return The tile index of the first spawn with the code, -1 if there is none
  */
-void Maze::makePositions()
+int Maze::findSpawn(int code) const
 {
-	int index = 0;
-	for (int y = 0; y < height + 1; y++) {
-		for (int x = 0; x < width + 1; x++) {
-			mazePositions.push_back(glm::vec3(x, y, 0));
-		}
-	}
+	std::vector <int>::const_iterator found = std::lower_bound(spawnsByCode.begin(), spawnsByCode.end(), code,
+		[&](int spawn, int value) { return spawns[spawn].code < value; });
+	if (found == spawnsByCode.end() || spawns[*found].code != code)
+		return -1;
+	return spawns[*found].tile;
 }
 
 /**
- * @brief Generates the maze, from the generation of the positions/vertices, to the OpenGL stuff. 
- * @see makePositions();
- * @see makeIndices();
+ * @brief Puts a pellet on every spawn that is still in the map, once the actors have been taken from them
+ * 		  (see ActorStore::spawnFromMaze()). The level file's map keeps the spawns, so that the level is saved with them.
+ * 
  */
-void Maze::generateMaze()
+void Maze::takeSpawns()
 {
-	makePositions();
-	makeIndices();
+	for (const MazeSpawn& spawn : spawns)
+	{
+		int x = spawn.tile % width, y = spawn.tile / width;
+		if (map2d[y][x] != spawn.code) continue;	//taken already, or changed by setTile()
+		map2d[y][x] = 0;
+		listPellet(spawn.tile);
+	}
+}
 
-	mazeVAO = new VertexArray;
-	mazeVAO->Bind();
-	mazeVBO = new VertexBuffer(&mazePositions[0], mazePositions.size() * sizeof(glm::vec3));
-	mazeVBO->Bind();
-	mazeVBLayout = new VertexBufferLayout;
-	mazeVBLayout->Push<float>(3);
-	mazeVAO->AddBuffer(*mazeVBO, *mazeVBLayout);
+/**
+ * @brief Eats the pellet on a tile, marking the tile as 9.
+ * 
+ * @param x - The horizontal tile
+ * @param y - The vertical tile
+ * @return true if the tile had a pellet
+ */
+bool Maze::eatPellet(int x, int y)
+{
+	if (map2d[y][x] != 0) return false;
+	map2d[y][x] = 9;
+	bitboard.setPellet(x, y, false);
+	eatenPellets.push_back(getTileIndex(x, y));
+	return true;
+}
 
-	mazeIBO = new IndexBuffer(&mazeIndices[0], mazeIndices.size());
+/**
+ * @brief Puts back every pellet eaten since the start of the level, only touching the eaten tiles.
+ * 
+ * @return The amount of pellets put back
+ */
+int Maze::restorePellets()
+{
+	int restored = 0;
+	for (int tile : eatenPellets)
+		if (map2d[tile / width][tile % width] == 9)	//not changed by setTile() since
+		{
+			map2d[tile / width][tile % width] = 0;
+			bitboard.setPellet(tile % width, tile / width, true);
+			restored++;
+		}
+	eatenPellets.clear();
+	return restored;
+}
 
-	m_Shader->createShaderProgram();
-	m_Shader->setUniform4f("u_Color", 0.f, 0.305f, 0.7f, 1.f);
+/**
+ * @brief Changes a tile while the level is played, for doors, moving walls or editing the level.
+ * 		  The level file's map and the pellet count are kept up to date, and only the exits of the tile
+ * 		  and of its four neighbours are found again. The JunctionGraph, MazeRenderer and Pellets have to
+ * 		  be told about the tile as well, see CampaignLevel::setTile().
+ * 
+ * @param x 	- The horizontal tile
+ * @param y 	- The vertical tile
+ * @param value - 1 for a wall, 0 for a pellet, 9 for an empty corridor
+ * @return true if the tile changed
+ */
+bool Maze::setTile(int x, int y, int value)
+{
+	int previous = map2d[y][x];
+	if (previous == value)
+		return false;
+
+	bool hadPellet = hasPellet(x, y);
+	map2d[y][x] = value;
+	m_LoadedLevel->mazeMap[getTileIndex(x, y)] = value;
+	bitboard.setTile(x, y, value);
+	if (value == 0)
+		listPellet(getTileIndex(x, y));
+	if (hadPellet != hasPellet(x, y))
+		pelletCount += hadPellet ? -1 : 1;
+	if ((previous == 1) != (value == 1))
+	{
+		//the tile, and the tiles that can lead to it, also over the edges
+		buildTileAdjacency(x, y);
+		buildTileAdjacency(x, (y + height - 1) % height);
+		buildTileAdjacency(x, (y + 1) % height);
+		buildTileAdjacency((x + 1) % width, y);
+		buildTileAdjacency((x + width - 1) % width, y);
+	}
+	return true;
 }
 
 /**
- * @brief Counts how many !1 occour in the maze, counting how many "pellets" exists
-*/
-void Maze::countPellets()
+ * @brief Finds the exits and neighbours of every tile. Walls have no exits,
+ * 		  and an exit over the edge of the maze is a tunnel to the walkable tile on the opposite edge.
+ */
+void Maze::buildAdjacency()
 {
-	for (int i = 0; i < m_LoadedLevel->mazeMap.size(); i++)
-		if (m_LoadedLevel->mazeMap[i] != 1)
-			pelletCount++;
+	exits.assign((size_t)width * height + 3, 0);	//padded, so that the movement kernels can read 4 bytes from any tile
+	neighbours.assign((size_t)width * height * 4, -1);
+
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+			buildTileAdjacency(x, y);
 }
 
 /**
- * @brief Draws the maze. 
+ * @brief Finds the exits and neighbours of one tile.
  * 
+ * @param x - The horizontal tile
+ * @param y - The vertical tile
  */
-void Maze::draw()
+void Maze::buildTileAdjacency(int x, int y)
 {
-	m_Shader->Bind();
-	m_Shader->camera(width, height);
-	m_Renderer->Draw(mazeVAO, mazeIBO, m_Shader);
+	const int dx[4] = { 0, 0, 1, -1 }, dy[4] = { -1, 1, 0, 0 };	//up, down, right, left
+
+	int tile = getTileIndex(x, y);
+	exits[tile] = 0;
+	for (int d = 0; d < 4; d++)
+		neighbours[tile * 4 + d] = -1;
+	if (map2d[y][x] == 1) return;
+
+	for (int d = 0; d < 4; d++)
+	{
+		int nx = (x + dx[d] + width) % width,	//wraps around to the opposite edge
+			ny = (y + dy[d] + height) % height;
+		if (map2d[ny][nx] == 1) continue;
+
+		exits[tile] |= 1 << d;
+		neighbours[tile * 4 + d] = getTileIndex(nx, ny);
+	}
 }
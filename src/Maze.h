@@ -10,16 +10,57 @@
  */
 #pragma once
 #include "ScenarioLoader.h"
-#include "VertexArray.h"
-#include "VertexBuffer.h"
-#include "VertexBufferLayout.h"
-#include "IndexBuffer.h"
-#include "Renderer.h"
-#include "Shader.h"
+#include "MazeBitboard.h"
+
+#include <vector>
+
+/**
+ * @brief A direction in the maze, also the direction an actor is currently moving.
+ * 
+ */
+enum Direction : int
+{
+	up = 0,
+	down = 1,
+	right = 2,
+	left = 3
+};
+
+/**
+ * @brief The opposite direction, up and down and right and left are pairs.
+ * 
+ */
+inline Direction opposite(Direction direction) { return (Direction)(direction ^ 1); }
+
+/**
+ * @brief A spawn in the level file, a tile with a value of 2 (Pacman) or more (the ghosts).
+ * 
+ */
+struct MazeSpawn
+{
+	int code,	//the tile's value in the level file
+		tile;
+};
+
+/**
+ * @brief The kinds of tiles counted when a level is loaded, see Maze::getTileCount().
+ * 
+ */
+enum TileType : int
+{
+	wallTile = 0,
+	pelletTile = 1,
+	spawnTile = 2,
+	tileTypes = 3
+};
 
 /**
  * @class Maze
- * @brief Handles the creation and drawing of the maze. 
+ * @brief Holds the layout of the maze. Drawing it is handled by the MazeRenderer.
+ * 		  For movement, every tile knows which directions it can be left in, and which tile that leads to.
+ * 		  A walkable tile on the edge of the maze leads to the opposite edge (a tunnel), when that tile is walkable too.
+ * 		  The level is read in one pass, which also finds the spawns, the pellets and how many tiles there are of each type,
+ * 		  so that nothing else has to search the whole map for them.
  */
 class Maze
 {
@@ -29,33 +70,48 @@ private:
 		pelletCount;
 
 	ScenarioLoader* m_LoadedLevel;
-	std::vector <unsigned int> mazeIndices;
-	std::vector <glm::vec3> mazePositions;
 
-	Renderer* m_Renderer;
-	Shader* m_Shader;
+	std::vector <unsigned char> exits;		 //one bit per direction, set when the tile can be left that way
+	std::vector <int>			neighbours;	 //four per tile, the tile reached in each direction, -1 for none
+	std::vector <int>			eatenPellets; //the tiles eaten since the start, see restorePellets()
+	MazeBitboard				bitboard;
 
-	VertexArray*		mazeVAO;
-	VertexBuffer*		mazeVBO;
-	VertexBufferLayout* mazeVBLayout;
-	IndexBuffer*		mazeIBO;
+	std::vector <MazeSpawn>		spawns;		 //in the order of the tiles
+	std::vector <int>			spawnsByCode; //indices into spawns, sorted by their codes
+	std::vector <int>			pelletTiles; //every tile that has had a pellet, see getPelletTiles()
+	std::vector <unsigned char> pelletListed; //per tile, 1 when it is in pelletTiles
+	int							tileCounts[tileTypes];
 public:
 
 	std::vector<std::vector<int>> map2d;
 
-	Maze(ScenarioLoader* loadedLevel, Shader* shader, Renderer* renderer);
-	~Maze();
+	Maze(ScenarioLoader* loadedLevel);
+
+	int getHeight() const	{ return height; }
+	int getWidth() const	{ return width; }
+	int getPelletCount() const { return pelletCount; }
+	int getRemainingPellets() const { return bitboard.countPellets(); }
+	const MazeBitboard& getBitboard() const { return bitboard; }
+	const std::vector <MazeSpawn>& getSpawns() const { return spawns; }
+	int findSpawn(int code) const;
+	void takeSpawns();
+	const std::vector <int>& getPelletTiles() const { return pelletTiles; }	//eaten pellets and walls are left in, check hasPellet()
+	int getTileCount(TileType type) const { return tileCounts[type]; }		//in the level as it was loaded
 
-	void draw();
-	std::vector <glm::vec3> getMazePositions() { return mazePositions; }
-	int getHeight()	{ return height; }
-	int getWidth()	{ return width; }
-	int getPelletCount() { return pelletCount; }
+	int getTileIndex(int x, int y) const { return y * width + x; }
+	bool canLeave(int tile, Direction direction) const { return exits[tile] >> direction & 1; }
+	int getNeighbour(int tile, Direction direction) const { return neighbours[tile * 4 + direction]; }
+	unsigned char getExits(int tile) const { return exits[tile]; }
+	const unsigned char* getExitTable() const { return exits.data(); }
+	bool isWalkable(int tile) const { return map2d[tile / width][tile % width] != 1; }
+	bool hasPellet(int x, int y) const { return map2d[y][x] == 0; }
+	bool eatPellet(int x, int y);
+	int  restorePellets();
+	bool setTile(int x, int y, int value);
 
 private:
-	void countPellets();
-	void make2dArray();
-	void makeIndices();
-	void makePositions();
-	void generateMaze();
+	void analyze();
+	void listPellet(int tile);
+	void buildAdjacency();
+	void buildTileAdjacency(int x, int y);
 };
@@ -0,0 +1,323 @@
+/**
+ * @file MazeBitboard.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the MazeBitboard class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "MazeBitboard.h"
+
+#include <algorithm>
+#include <bitset>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MAZE_BITBOARD_POPCNT
+#endif
+
+namespace
+{
+	int countBitsPortable(const uint64_t* words, size_t count)
+	{
+		int bits = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			bits += __builtin_popcountll(words[i]);
+#else
+			bits += (int)std::bitset<64>(words[i]).count();
+#endif
+		}
+		return bits;
+	}
+
+#ifdef MAZE_BITBOARD_POPCNT
+	//the same loop, compiled to the popcnt instruction, which is used when the processor has it
+	__attribute__((target("popcnt")))
+	int countBitsPopcnt(const uint64_t* words, size_t count)
+	{
+		int bits = 0;
+		for (size_t i = 0; i < count; i++)
+			bits += __builtin_popcountll(words[i]);
+		return bits;
+	}
+
+	bool detectPopcnt()
+	{
+		__builtin_cpu_init();	//may run before the constructors of the runtime
+		return __builtin_cpu_supports("popcnt") != 0;
+	}
+
+	const bool hasPopcnt = detectPopcnt();
+#endif
+}
+
+/**
+ * @brief Construct a new Maze Bitboard:: Maze Bitboard object, empty until build() is called.
+ *
+ */
+MazeBitboard::MazeBitboard()
+	: width(0),
+	  height(0),
+	  wordsPerRow(0),
+	  lastWordMask(0)
+{
+}
+
+/**
+ * @brief Makes every plane from the grid of a Maze.
+ *
+ * @param map2d - The tiles, 1 for a wall, 9 for an eaten pellet, a pellet for anything else
+ */
+void MazeBitboard::build(const std::vector <std::vector <int>>& map2d)
+{
+	height = (int)map2d.size();
+	width = height ? (int)map2d[0].size() : 0;
+	wordsPerRow = (width + 63) / 64;
+	lastWordMask = width % 64 ? (uint64_t(1) << width % 64) - 1 : ~uint64_t(0);
+
+	size_t words = (size_t)wordsPerRow * height;
+	walls.assign(words, 0);
+	walkable.assign(words, 0);
+	pellets.assign(words, 0);
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			int value = map2d[y][x];
+			setBit(walls, x, y, value == 1);
+			setBit(walkable, x, y, value != 1);
+			setBit(pellets, x, y, value != 1 && value != 9);
+		}
+
+	for (int d = 0; d < 4; d++)
+		exits[d].assign(words, 0);
+	for (int y = 0; y < height; y++)
+		buildExits(y);
+}
+
+/**
+ * @brief Finds the exits of one row from the walkable plane, a whole word at a time.
+ *
+ * @param y - The row
+ */
+void MazeBitboard::buildExits(int y)
+{
+	size_t row = (size_t)y * wordsPerRow,
+		   above = (size_t)((y + height - 1) % height) * wordsPerRow,
+		   below = (size_t)((y + 1) % height) * wordsPerRow;
+
+	//a tile can be left to the right when the tile to its right is walkable, which is that tile moved one to the left
+	moveLeft(&walkable[row], &exits[2][row]);
+	moveRight(&walkable[row], &exits[3][row]);
+	for (int w = 0; w < wordsPerRow; w++)
+	{
+		exits[0][row + w] = walkable[row + w] & walkable[above + w];
+		exits[1][row + w] = walkable[row + w] & walkable[below + w];
+		exits[2][row + w] &= walkable[row + w];
+		exits[3][row + w] &= walkable[row + w];
+	}
+}
+
+/**
+ * @brief Changes a tile, and finds the exits of its row and of the rows above and below again.
+ *
+ * @param x 	- The horizontal tile
+ * @param y 	- The vertical tile
+ * @param value - 1 for a wall, 9 for an eaten pellet, a pellet for anything else
+ */
+void MazeBitboard::setTile(int x, int y, int value)
+{
+	bool wasWall = isWall(x, y);
+	setBit(pellets, x, y, value != 1 && value != 9);
+	if (wasWall == (value == 1))
+		return;
+
+	setBit(walls, x, y, value == 1);
+	setBit(walkable, x, y, value != 1);
+	buildExits(y);
+	buildExits((y + height - 1) % height);
+	buildExits((y + 1) % height);
+}
+
+/**
+ * @brief Eats or puts back the pellet of a walkable tile.
+ *
+ * @param x 	 - The horizontal tile
+ * @param y 	 - The vertical tile
+ * @param pellet - true if the tile has a pellet
+ */
+void MazeBitboard::setPellet(int x, int y, bool pellet)
+{
+	setBit(pellets, x, y, pellet);
+}
+
+void MazeBitboard::setBit(std::vector <uint64_t>& plane, int x, int y, bool value) const
+{
+	uint64_t& word = plane[(size_t)y * wordsPerRow + x / 64];
+	uint64_t bit = uint64_t(1) << (x % 64);
+	word = value ? word | bit : word & ~bit;
+}
+
+/**
+ * @brief Counts the bits of some words, with the popcnt instruction when the processor has it.
+ *
+ * @param words - The words
+ * @param count - The amount of words
+ * @return The amount of set bits
+ */
+int MazeBitboard::countBits(const uint64_t* words, size_t count)
+{
+#ifdef MAZE_BITBOARD_POPCNT
+	if (hasPopcnt)
+		return countBitsPopcnt(words, count);
+#endif
+	return countBitsPortable(words, count);
+}
+
+/**
+ * @brief Counts the pellets that are left in the whole maze.
+ *
+ * @return The amount of pellets
+ */
+int MazeBitboard::countPellets() const
+{
+	return countBits(pellets.data(), pellets.size());
+}
+
+/**
+ * @brief Counts the pellets that are left in a rectangle of tiles, which is clipped to the maze.
+ *
+ * @param left 	 - The first column
+ * @param top 	 - The first row
+ * @param right  - The last column, included
+ * @param bottom - The last row, included
+ * @return The amount of pellets
+ */
+int MazeBitboard::countPellets(int left, int top, int right, int bottom) const
+{
+	left = std::max(left, 0);
+	top = std::max(top, 0);
+	right = std::min(right, width - 1);
+	bottom = std::min(bottom, height - 1);
+	if (left > right || top > bottom)
+		return 0;
+
+	int firstWord = left / 64,
+		lastWord = right / 64;
+	uint64_t firstMask = ~uint64_t(0) << (left % 64),
+			 lastMask = ~uint64_t(0) >> (63 - right % 64);
+
+	int count = 0;
+	for (int y = top; y <= bottom; y++)
+	{
+		const uint64_t* row = &pellets[(size_t)y * wordsPerRow];
+		if (firstWord == lastWord)
+		{
+			uint64_t word = row[firstWord] & firstMask & lastMask;
+			count += countBits(&word, 1);
+			continue;
+		}
+
+		uint64_t first = row[firstWord] & firstMask,
+				 last = row[lastWord] & lastMask;
+		count += countBits(&first, 1) + countBits(&last, 1) + countBits(row + firstWord + 1, lastWord - firstWord - 1);
+	}
+	return count;
+}
+
+/**
+ * @brief Counts the tiles that are not walls.
+ *
+ * @return The amount of tiles
+ */
+int MazeBitboard::countWalkable() const
+{
+	return countBits(walkable.data(), walkable.size());
+}
+
+/**
+ * @brief Moves every tile of a row one tile to the right, the last tile wraps around to the first.
+ *
+ * @param row - The row, wordsPerRow words
+ * @param out - The moved row, may not be the same as row
+ */
+void MazeBitboard::moveRight(const uint64_t* row, uint64_t* out) const
+{
+	uint64_t carry = 0;
+	for (int w = 0; w < wordsPerRow; w++)
+	{
+		out[w] = row[w] << 1 | carry;
+		carry = row[w] >> 63;
+	}
+
+	uint64_t wrapped = width % 64 ? out[wordsPerRow - 1] >> (width % 64) & 1 : carry;
+	out[wordsPerRow - 1] &= lastWordMask;
+	out[0] |= wrapped;
+}
+
+/**
+ * @brief Moves every tile of a row one tile to the left, the first tile wraps around to the last.
+ *
+ * @param row - The row, wordsPerRow words
+ * @param out - The moved row, may not be the same as row
+ */
+void MazeBitboard::moveLeft(const uint64_t* row, uint64_t* out) const
+{
+	for (int w = 0; w < wordsPerRow; w++)
+		out[w] = row[w] >> 1 | (w + 1 < wordsPerRow ? row[w + 1] << 63 : 0);
+	out[(width - 1) / 64] |= (row[0] & 1) << ((width - 1) % 64);
+}
+
+/**
+ * @brief Takes a set of tiles one step further: every walkable tile that is in the set or next to it.
+ * 		  This is one breadth first search frontier for every tile of the set at once.
+ *
+ * @param tiles - The set, one plane of getWordCount() words
+ * @param out 	- The set one step further, may not be the same as tiles
+ */
+void MazeBitboard::spread(const uint64_t* tiles, uint64_t* out) const
+{
+	std::vector <uint64_t> moved(wordsPerRow * 2);
+	for (int y = 0; y < height; y++)
+	{
+		size_t row = (size_t)y * wordsPerRow,
+			   above = (size_t)((y + height - 1) % height) * wordsPerRow,
+			   below = (size_t)((y + 1) % height) * wordsPerRow;
+
+		moveRight(tiles + row, &moved[0]);
+		moveLeft(tiles + row, &moved[wordsPerRow]);
+		for (int w = 0; w < wordsPerRow; w++)
+			out[row + w] = (tiles[row + w] | tiles[above + w] | tiles[below + w] | moved[w] | moved[wordsPerRow + w]) &
+						   walkable[row + w];
+	}
+}
+
+/**
+ * @brief Finds every tile that can be reached from a tile, by spreading until the set stops growing.
+ *
+ * @param x   - The horizontal tile
+ * @param y   - The vertical tile
+ * @param out - Filled with the reachable tiles, one plane of getWordCount() words
+ * @return The amount of reachable tiles, 0 if the tile is a wall
+ */
+int MazeBitboard::reachable(int x, int y, std::vector <uint64_t>& out) const
+{
+	out.assign(walls.size(), 0);
+	if (isWall(x, y))
+		return 0;
+
+	setBit(out, x, y, true);
+	std::vector <uint64_t> next(walls.size());
+	int count = 1;
+	while (true)
+	{
+		spread(out.data(), next.data());
+		int nextCount = countBits(next.data(), next.size());
+		out.swap(next);
+		if (nextCount == count)
+			return count;
+		count = nextCount;
+	}
+}
@@ -0,0 +1,73 @@
+/**
+ * @file MazeBitboard.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the MazeBitboard class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class MazeBitboard
+ * @brief The walls, the pellets and the exits of every tile as planes of bits, one bit per tile, kept next to the Maze's grid.
+ * 		  Every row starts on a new 64 bit word, and the bits past the width of the maze are always 0.
+ * 		  Counting is done with popcount and moving a set of tiles one step is done with shifts, 64 tiles per operation,
+ * 		  so whole-board questions (the pellets left in an area, the tiles that can be reached) do not touch the grid.
+ * 		  Like the Maze, the edges wrap around: a tile on an edge leads to the tile on the opposite edge.
+ */
+class MazeBitboard
+{
+private:
+	int width,
+		height,
+		wordsPerRow;
+	uint64_t lastWordMask;	//the bits of the last word of a row that are inside the maze
+
+	std::vector <uint64_t> walls,
+						   walkable,	//the tiles that are not walls, to save inverting the walls and masking the padding
+						   pellets,		//the walkable tiles whose pellet has not been eaten
+						   exits[4];	//per direction, the tiles that can be left that way
+public:
+	MazeBitboard();
+
+	void build(const std::vector <std::vector <int>>& map2d);
+	void setTile(int x, int y, int value);
+	void setPellet(int x, int y, bool pellet);
+
+	int getWidth() const		{ return width; }
+	int getHeight() const		{ return height; }
+	int getWordsPerRow() const	{ return wordsPerRow; }
+	size_t getWordCount() const { return walls.size(); }
+	const uint64_t* getWalls() const			 { return walls.data(); }
+	const uint64_t* getWalkable() const			 { return walkable.data(); }
+	const uint64_t* getPellets() const			 { return pellets.data(); }
+	const uint64_t* getExits(int direction) const { return exits[direction].data(); }
+
+	bool isWall(int x, int y) const	   { return getBit(walls, x, y); }
+	bool hasPellet(int x, int y) const { return getBit(pellets, x, y); }
+	bool canLeave(int x, int y, int direction) const { return getBit(exits[direction], x, y); }
+
+	int countPellets() const;
+	int countPellets(int left, int top, int right, int bottom) const;
+	int countWalkable() const;
+	void spread(const uint64_t* tiles, uint64_t* out) const;
+	int  reachable(int x, int y, std::vector <uint64_t>& out) const;
+
+	static int countBits(const uint64_t* words, size_t count);
+	void moveRight(const uint64_t* row, uint64_t* out) const;
+	void moveLeft(const uint64_t* row, uint64_t* out) const;
+
+private:
+	bool getBit(const std::vector <uint64_t>& plane, int x, int y) const
+	{
+		return plane[(size_t)y * wordsPerRow + x / 64] >> (x % 64) & 1;
+	}
+	void setBit(std::vector <uint64_t>& plane, int x, int y, bool value) const;
+	void buildExits(int y);
+};
@@ -0,0 +1,198 @@
+/**
+ * @file MazeChunk.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the MazeChunk class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "MazeChunk.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+/**
+ * @brief Construct a new Maze Chunk:: Maze Chunk object, without building its mesh.
+ * 
+ * @param originX 	  - The column of the chunk's top left tile
+ * @param originY 	  - The row of the chunk's top left tile
+ * @param chunkWidth  - The amount of columns in the chunk, less than size at the edge of the maze
+ * @param chunkHeight - The amount of rows in the chunk, less than size at the edge of the maze
+ */
+MazeChunk::MazeChunk(int originX, int originY, int chunkWidth, int chunkHeight)
+	: originX(originX),
+	  originY(originY),
+	  chunkWidth(chunkWidth),
+	  chunkHeight(chunkHeight),
+	  built(false),
+	  dirty(false),
+	  chunkVAO(nullptr),
+	  chunkVBO(nullptr),
+	  chunkIBO(nullptr),
+	  pelletVAO(nullptr),
+	  pelletVBO(nullptr),
+	  pelletIBO(nullptr)
+{
+}
+
+/**
+ * @brief Destroy the Maze Chunk:: Maze Chunk object
+ * 
+ */
+MazeChunk::~MazeChunk()
+{
+	release();
+}
+
+/**
+ * @brief Builds the chunk's positions and the indices of its walls, and a quad for every tile that has a pellet.
+ * 		  Does not use OpenGL.
+ * 
+ * @param maze - The maze the chunk is a part of
+ */
+void MazeChunk::build(Maze* maze)
+{
+	chunkPositions.clear();
+	chunkIndices.clear();
+	pelletVertices.clear();
+	pelletIndices.clear();
+
+	//Since we require +1 more positions than the amount of squares it is incremented.
+	int indicesWidth = chunkWidth + 1;
+	for (int y = 0; y < chunkHeight + 1; y++)
+		for (int x = 0; x < indicesWidth; x++)
+			chunkPositions.push_back({ { (GLushort)x, (GLushort)y } });
+
+	for (int i = 0; i < chunkHeight; i++) {
+		for (int j = 0; j < chunkWidth; j++) {
+			if (maze->map2d[originY + i][originX + j] == 1) {
+				chunkIndices.push_back((i * indicesWidth) + j);
+				chunkIndices.push_back((i * indicesWidth) + j + 1);
+				chunkIndices.push_back(((i + 1) * indicesWidth) + j);
+
+				chunkIndices.push_back((i * indicesWidth) + j + 1);
+				chunkIndices.push_back(((i + 1) * indicesWidth) + j);
+				chunkIndices.push_back(((i + 1) * indicesWidth) + (j + 1));
+			}
+			else if (maze->hasPellet(originX + j, originY + i)) {
+				unsigned int k = (unsigned int)pelletVertices.size();
+				GLushort left = j, right = j + 1, top = i, bottom = i + 1;
+				pelletVertices.push_back({ { left,  top	   }, { 0,	   65535 } });	//position, texture
+				pelletVertices.push_back({ { right, top	   }, { 65535, 65535 } });
+				pelletVertices.push_back({ { left,  bottom }, { 0,	   0	 } });
+				pelletVertices.push_back({ { right, bottom }, { 65535, 0	 } });
+
+				unsigned int quad[6] = { k, k + 1, k + 2, k + 1, k + 2, k + 3 };
+				pelletIndices.insert(pelletIndices.end(), quad, quad + 6);
+			}
+		}
+	}
+	built = true;
+	dirty = false;
+}
+
+/**
+ * @brief Sends the chunk's meshes to the GPU, a chunk without walls and pellets is not uploaded.
+ * 		  The OpenGL objects are made when the chunk first gets a wall or a pellet on the GPU. After that a rebuilt chunk,
+ * 		  such as one where a pellet has been eaten, is sent into the same buffers until the chunk is released.
+ * 		  The meshes on the CPU are cleared afterwards, the chunk has to be built again before the next upload.
+ * 
+ */
+void MazeChunk::upload()
+{
+	//the index buffer is bound to the vertex array that is bound, which has to be the chunk's own
+	if (chunkVAO)	//the positions are the same in every build, only the walls change
+	{
+		chunkVAO->Bind();
+		chunkIBO->selectIndices(chunkIndices.data(), chunkIndices.size());
+	}
+	else if (!chunkIndices.empty())
+	{
+		chunkVAO = new VertexArray;
+		chunkVAO->Bind();
+		chunkVBO = new VertexBuffer(chunkPositions.data(), chunkPositions.size() * sizeof(MazeVertex));
+		chunkVBO->Bind();
+		chunkVAO->AddBuffer<MazeVertex>(*chunkVBO);
+
+		chunkIBO = new IndexBuffer(chunkIndices.data(), chunkIndices.size(), chunkPositions.size());
+	}
+
+	if (pelletVAO)
+	{
+		pelletVAO->Bind();
+		pelletVBO->updateBuffer(pelletVertices.data(), pelletVertices.size() * sizeof(TexturedVertex));
+		pelletIBO->selectIndices(pelletIndices.data(), pelletIndices.size());
+	}
+	else if (!pelletIndices.empty())
+	{
+		pelletVAO = new VertexArray;
+		pelletVAO->Bind();
+		pelletVBO = new VertexBuffer(pelletVertices.data(), pelletVertices.size() * sizeof(TexturedVertex));
+		pelletVBO->Bind();
+		pelletVAO->AddBuffer<TexturedVertex>(*pelletVBO);
+
+		//sized for a pellet on every tile, so that the index type fits every later build
+		pelletIBO = new IndexBuffer(pelletIndices.data(), pelletIndices.size(), chunkWidth * chunkHeight * 4);
+	}
+
+	if (!isUploaded())
+		return;
+	chunkIndices.clear();	//the memory is kept for the next build, until the chunk is released
+	chunkPositions.clear();
+	pelletIndices.clear();
+	pelletVertices.clear();
+	built = false;
+}
+
+/**
+ * @brief Deletes the chunk's OpenGL objects, and the memory kept for its meshes.
+ * 
+ */
+void MazeChunk::release()
+{
+	delete chunkVAO;
+	delete chunkVBO;
+	delete chunkIBO;
+	chunkVAO = nullptr; chunkVBO = nullptr; chunkIBO = nullptr;
+	delete pelletVAO;
+	delete pelletVBO;
+	delete pelletIBO;
+	pelletVAO = nullptr; pelletVBO = nullptr; pelletIBO = nullptr;
+
+	std::vector <unsigned int>().swap(chunkIndices);
+	std::vector <MazeVertex>().swap(chunkPositions);
+	std::vector <unsigned int>().swap(pelletIndices);
+	std::vector <TexturedVertex>().swap(pelletVertices);
+	built = false;
+}
+
+/**
+ * @brief Draws the chunk, the shader's camera has to be set already.
+ * 
+ * @param renderer - The renderer used for drawing
+ * @param shader   - The maze's shader
+ */
+void MazeChunk::draw(Renderer* renderer, Shader* shader)
+{
+	if (!chunkVAO || !chunkIBO->getCount())
+		return;
+
+	shader->setUniformMat4("u_TransformationMat", glm::translate(glm::mat4(1.f), glm::vec3(originX, originY, 0.f)));
+	renderer->Draw(chunkVAO, chunkIBO, shader);
+}
+
+/**
+ * @brief Draws the chunk's pellets, the shader's camera and the pellet texture have to be set already.
+ * 
+ * @param renderer - The renderer used for drawing
+ * @param shader   - The pellets' shader
+ */
+void MazeChunk::drawPellets(Renderer* renderer, Shader* shader)
+{
+	if (!pelletVAO || !pelletIBO->getCount())
+		return;
+
+	shader->setUniformMat4("u_TransformationMat", glm::translate(glm::mat4(1.f), glm::vec3(originX, originY, 0.f)));
+	renderer->Draw(pelletVAO, pelletIBO, shader);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file MazeChunk.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the MazeChunk class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include "Maze.h"
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include "Renderer.h"
+#include "Shader.h"
+#include "Vertex.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * @class MazeChunk
+ * @brief A square part of the maze with meshes of its own, one for the walls and one for the pellets.
+ * 		  The meshes are built on the CPU and uploaded to the GPU separately, and both can be thrown away again
+ * 		  when the chunk is out of view. Positions are relative to the chunk's origin.
+ * 		  Only the tiles with a pellet get vertices, so a chunk that is eaten empty draws nothing.
+ */
+class MazeChunk
+{
+private:
+	int originX,
+		originY,
+		chunkWidth,
+		chunkHeight;
+
+	bool built,
+		 dirty;		//a tile has changed since the meshes were built
+	std::vector <unsigned int>	chunkIndices;
+	std::vector <MazeVertex>	chunkPositions;
+	std::vector <unsigned int>	pelletIndices;
+	std::vector <TexturedVertex> pelletVertices;
+
+	VertexArray*		chunkVAO;
+	VertexBuffer*		chunkVBO;
+	IndexBuffer*		chunkIBO;
+	VertexArray*		pelletVAO;
+	VertexBuffer*		pelletVBO;
+	IndexBuffer*		pelletIBO;
+public:
+	static const int size = 32;	//width and height of a chunk in tiles
+
+	MazeChunk(int originX, int originY, int chunkWidth, int chunkHeight);
+	~MazeChunk();
+
+	void build(Maze* maze);
+	void upload();
+	void release();
+	void draw(Renderer* renderer, Shader* shader);
+	void drawPellets(Renderer* renderer, Shader* shader);
+	void markDirty()		{ dirty = true; }
+
+	bool isBuilt() const	{ return built; }
+	bool isDirty() const	{ return dirty; }
+	bool isUploaded() const { return chunkVAO != nullptr || pelletVAO != nullptr; }
+	int getOriginX() const	{ return originX; }
+	int getOriginY() const	{ return originY; }
+};
@@ -0,0 +1,227 @@
+/**
+ * @file MazeGenerator.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the MazeGenerator class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "MazeGenerator.h"
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief Construct a new Maze Generator:: Maze Generator object
+ *
+ * @param settings - The size, seed and shape of the maze. Sizes that are too small are increased.
+ */
+MazeGenerator::MazeGenerator(const MazeGeneratorSettings& settings)
+	: settings(settings)
+{
+	width  = std::max(settings.width, settings.symmetric ? 7 : 5);
+	height = std::max(settings.height, 5);
+
+	halfWidth = settings.symmetric ? (width + 1) / 2 : width;
+	int lastColumn = settings.symmetric ? halfWidth - 2 : width - 2;	//the last column that may hold a cell
+	cellsX = (lastColumn - 1) / 2 + 1;
+	cellsY = (height - 3) / 2 + 1;
+	cellRowsPerRegion = std::max(1, settings.regionHeight / 2);
+}
+
+/**
+ * @brief Generates a new maze.
+ *
+ * @return The maze, row by row, where 1 is a wall, 0 a pellet, 2 Pacman and 3 and up are ghosts.
+ */
+std::vector <int> MazeGenerator::generate()
+{
+	map.assign((size_t)width * height, 1);
+
+	int regions = (cellsY + cellRowsPerRegion - 1) / cellRowsPerRegion;
+	int threads = settings.threads > 0 ? settings.threads : (int)std::thread::hardware_concurrency();
+	threads = std::max(1, std::min(threads, regions));
+
+	//every region only writes to its own rows, so the workers need no synchronization
+	std::vector <std::thread> workers;
+	for (int t = 1; t < threads; t++)
+		workers.emplace_back([this, t, threads, regions]() {
+			for (int region = t; region < regions; region += threads)
+				generateRegion(region);
+		});
+	for (int region = 0; region < regions; region += threads)
+		generateRegion(region);
+	for (auto& worker : workers)
+		worker.join();
+
+	addTunnels();
+	placeSpawns();
+	return std::move(map);
+}
+
+/**
+ * @brief Generates a new maze, and stores it in a ScenarioLoader as if it was loaded from file.
+ *
+ */
+ScenarioLoader MazeGenerator::generateScenario()
+{
+	std::vector <int> generated = generate();
+	return ScenarioLoader(width, height, std::move(generated));
+}
+
+/**
+ * @brief Carves one region of the maze: a randomized depth first search between the cells,
+ * 		  followed by opening extra walls so that there are loops and no dead ends, like in Pac-Man.
+ *
+ * @param region - Which region, counted from the top
+ */
+void MazeGenerator::generateRegion(int region)
+{
+	std::mt19937 rng(settings.seed * 2654435761u + (uint32_t)region);
+	auto chance = [&](float probability) { return (rng() % 1000) < (uint32_t)(probability * 1000.f); };
+
+	int firstCell = region * cellRowsPerRegion,
+		lastCell  = std::min(firstCell + cellRowsPerRegion, cellsY),
+		rows	  = lastCell - firstCell;
+	int yBegin = region == 0 ? 0 : 2 * firstCell,		//the region owns the wall row above its first cell row
+		yEnd   = lastCell == cellsY ? height : 2 * lastCell;
+
+	auto cellX = [](int cx) { return 1 + 2 * cx; };
+	auto cellY = [&](int cy) { return 1 + 2 * (firstCell + cy); };
+	const int dx[4] = { 0, 0, 1, -1 }, dy[4] = { -1, 1, 0, 0 };
+	auto inside = [&](int cx, int cy) { return cx >= 0 && cx < cellsX && cy >= 0 && cy < rows; };
+	auto wallBetween = [&](int cx, int cy, int d) -> int& { return tile(cellX(cx) + dx[d], cellY(cy) + dy[d]); };
+
+	for (int cy = 0; cy < rows; cy++)
+		for (int cx = 0; cx < cellsX; cx++)
+			tile(cellX(cx), cellY(cy)) = 0;
+
+	//depth first search, carving the wall between every cell and the cell it was reached from
+	std::vector <char> visited(cellsX * rows, 0);
+	std::vector <int> stack;
+	int start = rng() % (cellsX * rows);
+	stack.push_back(start); visited[start] = 1;
+	while (!stack.empty())
+	{
+		int cx = stack.back() % cellsX, cy = stack.back() / cellsX;
+		int options[4], optionCount = 0;
+		for (int d = 0; d < 4; d++)
+			if (inside(cx + dx[d], cy + dy[d]) && !visited[(cy + dy[d]) * cellsX + cx + dx[d]])
+				options[optionCount++] = d;
+
+		if (optionCount == 0) { stack.pop_back(); continue; }
+
+		int d = options[rng() % optionCount];
+		wallBetween(cx, cy, d) = 0;
+		int next = (cy + dy[d]) * cellsX + cx + dx[d];
+		visited[next] = 1;
+		stack.push_back(next);
+	}
+
+	//removes some of the remaining walls, more corridors gives more loops
+	for (int cy = 0; cy < rows; cy++)
+		for (int cx = 0; cx < cellsX; cx++)
+			for (int d = 1; d <= 2; d++)	//down and right, so that every wall is only considered once
+				if (inside(cx + dx[d], cy + dy[d]) && wallBetween(cx, cy, d) == 1 && chance(settings.corridorDensity))
+					wallBetween(cx, cy, d) = 0;
+
+	//opens a wall next to every dead end
+	for (int cy = 0; cy < rows; cy++)
+		for (int cx = 0; cx < cellsX; cx++)
+		{
+			int closed[4], closedCount = 0, open = 0;
+			for (int d = 0; d < 4; d++)
+			{
+				if (!inside(cx + dx[d], cy + dy[d])) continue;
+				if (wallBetween(cx, cy, d) == 0) open++;
+				else closed[closedCount++] = d;
+			}
+			if (open == 1 && closedCount > 0)
+				wallBetween(cx, cy, closed[rng() % closedCount]) = 0;
+		}
+
+	//connects the region to the one above it
+	if (region > 0)
+	{
+		int connections = std::max(1, cellsX / 8);
+		for (int i = 0; i < connections; i++)
+			tile(cellX(rng() % cellsX), yBegin) = 0;
+	}
+
+	if (settings.symmetric)
+	{
+		//opens crossings through the middle, so that the two halves are connected
+		int firstCrossing = rng() % rows;
+		for (int cy = 0; cy < rows; cy++)
+			if (cy == firstCrossing || chance(0.25f))
+				for (int x = cellX(cellsX - 1) + 1; x < halfWidth; x++)
+					tile(x, cellY(cy)) = 0;
+
+		for (int y = yBegin; y < yEnd; y++)
+			for (int x = 0; x < halfWidth; x++)
+				tile(width - 1 - x, y) = tile(x, y);
+	}
+}
+
+/**
+ * @brief Opens the outer walls on both sides of some of the rows, so that they wrap around.
+ *
+ */
+void MazeGenerator::addTunnels()
+{
+	int tunnels = std::min(settings.tunnels, cellsY);
+	for (int t = 0; t < tunnels; t++)
+	{
+		int y = 1 + 2 * ((t + 1) * cellsY / (tunnels + 1));
+		if (y >= height - 1) continue;
+
+		for (int x = 0; x < width && tile(x, y) == 1; x++)
+			tile(x, y) = 0;
+		for (int x = width - 1; x >= 0 && tile(x, y) == 1; x--)
+			tile(x, y) = 0;
+	}
+}
+
+/**
+ * @brief Places Pacman below the center of the maze, and the ghosts as close to the center as possible.
+ *
+ */
+void MazeGenerator::placeSpawns()
+{
+	auto nearestCell = [&](int x, int y) {
+		int cx = std::min(std::max((x - 1) / 2, 0), cellsX - 1);
+		int cy = std::min(std::max((y - 1) / 2, 0), cellsY - 1);
+		return (1 + 2 * cy) * width + 1 + 2 * cx;
+	};
+
+	int pacman = nearestCell(width / 2, height * 3 / 4);
+	map[pacman] = 2;
+
+	//breadth first search from the center, giving the closest free tiles to the ghosts
+	std::vector <char> visited(map.size(), 0);
+	std::vector <int> queue;
+	int start = nearestCell(width / 2, height / 2);
+	queue.push_back(start); visited[start] = 1;
+
+	int ghostID = 3;
+	for (size_t head = 0; head < queue.size() && ghostID < 3 + settings.ghosts; head++)
+	{
+		int current = queue[head];
+		if (map[current] == 0)
+			map[current] = ghostID++;
+
+		int x = current % width, y = current / width;
+		int neighbours[4] = { current - width, current + width, current + 1, current - 1 };
+		bool valid[4] = { y > 0, y < height - 1, x < width - 1, x > 0 };
+		for (int d = 0; d < 4; d++)
+			if (valid[d] && !visited[neighbours[d]] && map[neighbours[d]] != 1)
+			{
+				visited[neighbours[d]] = 1;
+				queue.push_back(neighbours[d]);
+			}
+	}
+}
@@ -0,0 +1,64 @@
+/**
+ * @file MazeGenerator.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the MazeGenerator class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "ScenarioLoader.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The settings used by the MazeGenerator.
+ *
+ */
+struct MazeGeneratorSettings
+{
+	int		 width			 = 28,
+			 height			 = 36;
+	uint32_t seed			 = 0;
+	bool	 symmetric		 = true;	//mirrors the left half of the maze onto the right half
+	int		 tunnels		 = 1;		//rows where the maze wraps around from the left to the right edge
+	float	 corridorDensity = 0.25f;	//0 - 1, the chance of removing each wall left between two corridors
+	int		 ghosts			 = 4;		//ghosts get the IDs 3, 4, 5...
+	int		 regionHeight	 = 64;		//rows of tiles generated by each worker thread
+	int		 threads		 = 0;		//0 uses one thread per core
+};
+
+/**
+ * @class MazeGenerator
+ * @brief Generates Pac-Man style mazes of any size, in the same format as the level files.
+ * 		  The maze is split into horizontal regions that are carved in parallel and then stitched together.
+ * 		  The same seed always gives the same maze, regardless of the amount of threads.
+ */
+class MazeGenerator
+{
+private:
+	MazeGeneratorSettings settings;
+
+	int width,
+		height,
+		halfWidth,		//the amount of columns that are carved, the rest is mirrored when symmetric
+		cellsX,			//corridor "cells" lie on the odd rows and columns
+		cellsY,
+		cellRowsPerRegion;
+
+	std::vector <int> map;
+public:
+	MazeGenerator(const MazeGeneratorSettings& settings);
+
+	std::vector <int> generate();
+	ScenarioLoader generateScenario();
+
+private:
+	int& tile(int x, int y) { return map[y * width + x]; }
+	void generateRegion(int region);
+	void addTunnels();
+	void placeSpawns();
+};
@@ -0,0 +1,204 @@
+/**
+ * @file MazeRenderer.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the MazeRenderer class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "MazeRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Construct a new Maze Renderer:: Maze Renderer object. No meshes are made until the chunks are built or drawn.
+ * 
+ * @param maze 		- The maze that is drawn
+ * @param shader 		 - The maze's shader
+ * @param pelletShader - The pellets' shader
+ * @param renderer 	 - The maze's renderer
+ */
+MazeRenderer::MazeRenderer(Maze* maze, Shader* shader, Shader* pelletShader, Renderer* renderer)
+	: m_Maze(maze),
+	  m_Shader(shader),
+	  m_PelletShader(pelletShader),
+	  m_Renderer(renderer),
+	  pelletTexture(nullptr)
+{
+	chunksX = (m_Maze->getWidth() + MazeChunk::size - 1) / MazeChunk::size;
+	chunksY = (m_Maze->getHeight() + MazeChunk::size - 1) / MazeChunk::size;
+
+	for (int cy = 0; cy < chunksY; cy++)
+		for (int cx = 0; cx < chunksX; cx++)
+		{
+			int x = cx * MazeChunk::size, y = cy * MazeChunk::size;
+			chunks.push_back(new MazeChunk(x, y, std::min(MazeChunk::size, m_Maze->getWidth() - x),
+												 std::min(MazeChunk::size, m_Maze->getHeight() - y)));
+		}
+
+}
+
+/**
+ * @brief Destroy the Maze Renderer:: Maze Renderer object
+ * 
+ */
+MazeRenderer::~MazeRenderer()
+{
+	for (size_t i = 0; i < chunks.size(); i++)
+		delete chunks[i];
+	delete pelletTexture;
+}
+
+/**
+ * @brief Finds the chunks that are visible to the camera.
+ * 
+ * @param camera - The camera deciding what is visible
+ */
+void MazeRenderer::getVisibleChunks(const Camera& camera, int& firstX, int& lastX, int& firstY, int& lastY) const
+{
+	firstX = std::max(0, (int)std::floor(camera.getLeft() / MazeChunk::size));
+	lastX  = std::min(chunksX - 1, (int)std::floor(camera.getRight() / MazeChunk::size));
+	firstY = std::max(0, (int)std::floor(camera.getTop() / MazeChunk::size));
+	lastY  = std::min(chunksY - 1, (int)std::floor(camera.getBottom() / MazeChunk::size));
+}
+
+/**
+ * @brief Creates the shader programs of the maze and the pellets, unless they already exist, and the pellets' texture.
+ * 		  The shaders can be shared by the mazes of several levels.
+ * 
+ */
+void MazeRenderer::setupShader()
+{
+	if (!m_Shader->getShaderProgram())
+	{
+		m_Shader->createShaderProgram();
+		m_Shader->setUniform4f("u_Color", 0.f, 0.305f, 0.7f, 1.f);
+	}
+	if (!m_PelletShader->getShaderProgram())
+		m_PelletShader->createShaderProgram();
+	if (!pelletTexture)
+	{
+		pelletTexture = new Texture("res/smallPellet.png");
+		pelletTexture->Bind(0);
+		m_PelletShader->setUniform1i("u_Texture", 0);
+	}
+}
+
+/**
+ * @brief Sends a chunk's meshes to the GPU, building them first if needed or if a tile of the chunk has changed.
+ * 
+ * @param index - The index of the chunk
+ */
+void MazeRenderer::uploadChunk(int index)
+{
+	MazeChunk* chunk = chunks[index];
+	bool resident = chunk->isUploaded();
+	if (!chunk->isBuilt() || chunk->isDirty())
+		chunk->build(m_Maze);
+	chunk->upload();
+	if (chunk->isUploaded() && !resident)	//a resident chunk keeps its buffers, also when its last wall and pellet are gone
+		residentChunks.push_back(index);
+}
+
+/**
+ * @brief Builds the meshes of the chunks visible to the camera, without OpenGL. Used for a level that is prepared
+ * 		  on another thread, so that its first frames only have to upload the meshes.
+ * 
+ * @param camera - The camera the level starts with
+ */
+void MazeRenderer::build(const Camera& camera)
+{
+	int firstX, lastX, firstY, lastY;
+	getVisibleChunks(camera, firstX, lastX, firstY, lastY);
+	for (int cy = firstY; cy <= lastY; cy++)
+		for (int cx = firstX; cx <= lastX; cx++)
+			if (!chunks[cy * chunksX + cx]->isBuilt() && !chunks[cy * chunksX + cx]->isUploaded())
+				chunks[cy * chunksX + cx]->build(m_Maze);
+}
+
+/**
+ * @brief Uploads a few of the chunks visible to the camera, so that the uploads can be spread over several frames
+ * 		  before the maze is first drawn.
+ * 
+ * @param camera 	- The camera deciding what is visible
+ * @param maxChunks - The most chunks that are uploaded
+ * @return true when every visible chunk has been uploaded
+ */
+bool MazeRenderer::upload(const Camera& camera, int maxChunks)
+{
+	setupShader();
+
+	int firstX, lastX, firstY, lastY;
+	getVisibleChunks(camera, firstX, lastX, firstY, lastY);
+	for (int cy = firstY; cy <= lastY; cy++)
+		for (int cx = firstX; cx <= lastX; cx++)
+		{
+			int index = cy * chunksX + cx;
+			if (chunks[index]->isUploaded() && !chunks[index]->isDirty()) continue;
+			if (maxChunks == 0) return false;
+			uploadChunk(index);
+			if (chunks[index]->isUploaded()) maxChunks--;	//chunks without walls and pellets cost nothing
+		}
+	return true;
+}
+
+/**
+ * @brief Draws the walls and then the pellets of the chunks that are visible to the camera, and deletes the meshes
+ * 		  of chunks that are more than one chunk away from the visible area.
+ * 
+ * @param camera - The camera deciding what is visible
+ */
+void MazeRenderer::draw(const Camera& camera)
+{
+	setupShader();
+
+	int firstX, lastX, firstY, lastY;
+	getVisibleChunks(camera, firstX, lastX, firstY, lastY);
+
+	m_Shader->Bind();
+	m_Shader->camera(camera);
+	for (int cy = firstY; cy <= lastY; cy++)
+		for (int cx = firstX; cx <= lastX; cx++)
+		{
+			int index = cy * chunksX + cx;
+			if (!chunks[index]->isUploaded() || chunks[index]->isDirty())
+				uploadChunk(index);
+			chunks[index]->draw(m_Renderer, m_Shader);
+		}
+
+	m_PelletShader->Bind();
+	m_PelletShader->camera(camera);
+	pelletTexture->Bind(0);
+	for (int cy = firstY; cy <= lastY; cy++)
+		for (int cx = firstX; cx <= lastX; cx++)
+			chunks[cy * chunksX + cx]->drawPellets(m_Renderer, m_PelletShader);
+
+	//keeps a margin of one chunk, so that scrolling back and forth does not rebuild the same chunks
+	for (size_t i = 0; i < residentChunks.size(); )
+	{
+		int cx = residentChunks[i] % chunksX, cy = residentChunks[i] / chunksX;
+		if (cx < firstX - 1 || cx > lastX + 1 || cy < firstY - 1 || cy > lastY + 1)
+		{
+			chunks[residentChunks[i]]->release();
+			residentChunks[i] = residentChunks.back();
+			residentChunks.pop_back();
+		}
+		else i++;
+	}
+}
+
+/**
+ * @brief Marks the chunk holding a tile to be built again, after the tile has been changed with Maze::setTile()
+ * 		  or its pellet has been eaten or put back. The chunk is rebuilt once when it is next drawn or uploaded,
+ * 		  however many of its tiles have changed meanwhile.
+ * 
+ * @param x - The horizontal tile
+ * @param y - The vertical tile
+ */
+void MazeRenderer::updateTile(int x, int y)
+{
+	chunks[(y / MazeChunk::size) * chunksX + x / MazeChunk::size]->markDirty();
+}
@@ -0,0 +1,55 @@
+/**
+ * @file MazeRenderer.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the MazeRenderer class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include "Maze.h"
+#include "MazeChunk.h"
+#include "Camera.h"
+#include "Renderer.h"
+#include "Shader.h"
+#include "Texture.h"
+
+#include <vector>
+
+/**
+ * @class MazeRenderer
+ * @brief Draws the maze and its pellets chunk by chunk. Only the chunks visible to the camera are drawn,
+ * 		  their meshes are made the first time they are seen and deleted when they are out of view again.
+ * 		  OpenGL is not used until the maze is drawn or uploaded, so the renderer can be made and built on another thread.
+ */
+class MazeRenderer
+{
+private:
+	int chunksX,
+		chunksY;
+
+	Maze*		m_Maze;
+	Shader*		m_Shader;
+	Shader*		m_PelletShader;
+	Renderer*	m_Renderer;
+	Texture*	pelletTexture;	//made with the shaders, see setupShader()
+
+	std::vector <MazeChunk*> chunks;
+	std::vector <int>		 residentChunks;	//the chunks that currently have a mesh on the GPU
+public:
+	MazeRenderer(Maze* maze, Shader* shader, Shader* pelletShader, Renderer* renderer);
+	~MazeRenderer();
+
+	void build(const Camera& camera);
+	bool upload(const Camera& camera, int maxChunks);
+	void draw(const Camera& camera);
+	void updateTile(int x, int y);
+	int getResidentChunkCount() const { return (int)residentChunks.size(); }
+
+private:
+	void getVisibleChunks(const Camera& camera, int& firstX, int& lastX, int& firstY, int& lastY) const;
+	void setupShader();
+	void uploadChunk(int index);
+};
@@ -0,0 +1,165 @@
+/**
+ * @file MovementKernel.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the MovementKernel class: the scalar kernel and the choice of kernel.
+ * 		  The SIMD kernels are in their own files, as they are compiled with other instruction sets.
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "MovementKernel.h"
+#include "ActorStore.h"
+
+#include <algorithm>
+
+#if defined(MOVEMENT_KERNEL_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+	//asks the CPU once, the kernel is checked before every tick
+	bool detectSupport(MovementKernelType type)
+	{
+#if defined(MOVEMENT_KERNEL_X86) && defined(_MSC_VER)
+		int registers[4];
+		__cpuid(registers, 1);
+		bool sse41 = registers[2] & (1 << 19),
+			 avx   = (registers[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;	//the operating system saves the AVX registers
+		__cpuidex(registers, 7, 0);
+		bool avx2  = avx && (registers[1] & (1 << 5));
+		return type == sse41Kernel ? sse41 : type == avx2Kernel && avx2;
+#elif defined(MOVEMENT_KERNEL_X86)
+		__builtin_cpu_init();
+		return type == sse41Kernel ? __builtin_cpu_supports("sse4.1") != 0
+								   : type == avx2Kernel && __builtin_cpu_supports("avx2");
+#else
+		return false;
+#endif
+	}
+
+	const bool supported[movementKernelTypes] = { true, detectSupport(sse41Kernel), detectSupport(avx2Kernel) };
+}
+
+/**
+ * @brief Moves all actors one tick with a kernel. Falls back to the scalar kernel if the CPU does not support it.
+ * 
+ * @param type 	- The kernel
+ * @param batch - The actors
+ */
+void MovementKernel::run(MovementKernelType type, const MovementBatch& batch)
+{
+	if (!isSupported(type)) type = scalarKernel;
+	switch (type)
+	{
+		case avx2Kernel:  moveAVX2(batch);					 break;
+		case sse41Kernel: moveSSE41(batch);					 break;
+		default:		  moveScalar(batch, 0, batch.count); break;
+	}
+}
+
+/**
+ * @brief Finds the fastest kernel the CPU supports.
+ * 
+ */
+MovementKernelType MovementKernel::getBest()
+{
+	if (isSupported(avx2Kernel))  return avx2Kernel;
+	if (isSupported(sse41Kernel)) return sse41Kernel;
+	return scalarKernel;
+}
+
+/**
+ * @brief Checks if the CPU (and the operating system, for the AVX registers) supports a kernel.
+ * 		  The CPU is only asked once, when the program starts.
+ * 
+ * @param type - The kernel
+ */
+bool MovementKernel::isSupported(MovementKernelType type)
+{
+	return type >= 0 && type < movementKernelTypes && supported[type];
+}
+
+/**
+ * @brief The name of a kernel, for the benchmarks.
+ * 
+ */
+const char* MovementKernel::getName(MovementKernelType type)
+{
+	switch (type)
+	{
+		case avx2Kernel:  return "avx2";
+		case sse41Kernel: return "sse41";
+		default:		  return "scalar";
+	}
+}
+
+/**
+ * @brief Moves a range of the actors one tick, one actor at a time. Works for any speed.
+ * 
+ * @param batch - The actors
+ * @param begin - The first actor to move
+ * @param end 	- One past the last actor to move
+ */
+void MovementKernel::moveScalar(const MovementBatch& batch, int begin, int end)
+{
+	const int half = ActorStore::tileUnits / 2;
+	const int dx[4] = { 0, 0, 1, -1 }, dy[4] = { -1, 1, 0, 0 };	//up, down, right, left
+	auto canLeave = [&](int tile, Direction direction) { return batch.exits[tile] >> direction & 1; };
+
+	for (int i = begin; i < end; i++)
+	{
+		if (!batch.alive[i]) continue;
+
+		int tile = batch.tileY[i] * batch.width + batch.tileX[i];
+		batch.previousTile[i] = tile;
+		for (int remaining = batch.speed[i]; remaining > 0; )
+		{
+			Direction direction = batch.direction[i];
+			if (batch.offsetX[i] == 0 && batch.offsetY[i] == 0 &&
+				direction != batch.nextDirection[i] && canLeave(tile, batch.nextDirection[i]))
+			{
+				batch.direction[i] = batch.nextDirection[i];
+				continue;
+			}
+
+			bool horizontal = direction == left || direction == right;
+			int  sign = dx[direction] + dy[direction];
+			int& offset = horizontal ? batch.offsetX[i] : batch.offsetY[i];
+			int& across = horizontal ? batch.offsetY[i] : batch.offsetX[i];
+
+			int ahead = offset * sign;	//how far past the center the actor is, in its direction
+			if (ahead >= 0 && !canLeave(tile, direction))	//a wall, or the edge of the maze
+			{
+				offset = 0;
+				break;
+			}
+			across = 0;
+
+			if (ahead < 0)				//moves to the center first
+			{
+				int step = std::min(remaining, -ahead);
+				offset += sign * step; remaining -= step;
+				continue;
+			}
+
+			int step = std::min(remaining, half - ahead);
+			offset += sign * step; remaining -= step;
+			if (offset * sign == half)	//on the edge, the next tile is now closer
+			{
+				batch.tileX[i] = (batch.tileX[i] + dx[direction] + batch.width) % batch.width;
+				batch.tileY[i] = (batch.tileY[i] + dy[direction] + batch.height) % batch.height;
+				tile = batch.tileY[i] * batch.width + batch.tileX[i];
+				offset = -offset;
+				batch.enteredTile[i] = 1;
+			}
+		}
+	}
+}
+
+#ifndef MOVEMENT_KERNEL_X86
+void MovementKernel::moveSSE41(const MovementBatch& batch) { moveScalar(batch, 0, batch.count); }
+void MovementKernel::moveAVX2(const MovementBatch& batch)  { moveScalar(batch, 0, batch.count); }
+#endif
@@ -0,0 +1,72 @@
+/**
+ * @file MovementKernel.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the MovementKernel class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include "Maze.h"
+
+//the SIMD kernels are only built for x86, other CPUs use the scalar kernel
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MOVEMENT_KERNEL_X86 1
+#endif
+
+/**
+ * @brief The instruction sets the actors can be moved with.
+ * 
+ */
+enum MovementKernelType
+{
+	scalarKernel = 0,
+	sse41Kernel = 1,	//4 actors at a time
+	avx2Kernel = 2,		//8 actors at a time
+	movementKernelTypes = 3
+};
+
+/**
+ * @brief The actors and the maze, as plain arrays, for the movement kernels.
+ * 
+ */
+struct MovementBatch
+{
+	int*				 tileX;
+	int*				 tileY;
+	int*				 offsetX;
+	int*				 offsetY;
+	Direction*			 direction;
+	const Direction*	 nextDirection;
+	const int*			 speed;
+	const char*			 alive;
+	char*				 enteredTile;
+	int*				 previousTile;
+	int					 count;
+
+	const unsigned char* exits;		//Maze::getExitTable()
+	int					 width,
+						 height;
+};
+
+/**
+ * @class MovementKernel
+ * @brief Moves all actors one tick, see ActorSystems::move for the rules. The SIMD kernels move 4 or 8 actors
+ * 		  at a time without branches, which works as long as an actor moves less than half a tile per tick.
+ * 		  Groups with faster actors, and the actors left over at the end, are moved by the scalar kernel.
+ * 		  Every kernel gives exactly the same result, the best one the CPU supports is picked at runtime.
+ */
+class MovementKernel
+{
+public:
+	static void run(MovementKernelType type, const MovementBatch& batch);
+	static MovementKernelType getBest();
+	static bool isSupported(MovementKernelType type);
+	static const char* getName(MovementKernelType type);
+
+	static void moveScalar(const MovementBatch& batch, int begin, int end);
+	static void moveSSE41(const MovementBatch& batch);
+	static void moveAVX2(const MovementBatch& batch);
+};
@@ -0,0 +1,124 @@
+/**
+ * @file MovementKernelAVX2.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief The AVX2 movement kernel, compiled with AVX2 enabled (see CMakeLists.txt).
+ * 		  It is only called when the CPU supports AVX2.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "MovementKernel.h"
+#include "ActorStore.h"
+
+#ifdef MOVEMENT_KERNEL_X86
+#include <immintrin.h>
+
+/**
+ * @brief Moves all actors one tick, 8 at a time. Follows the same steps as moveScalar, with masks instead of branches:
+ * 		  a turn on the center, the way to the center, a turn on the center if it was reached during the tick,
+ * 		  and the way towards the next tile, moving to it when the edge is reached.
+ *
+ * @param batch - The actors
+ */
+void MovementKernel::moveAVX2(const MovementBatch& batch)
+{
+	const __m256i zero	  = _mm256_setzero_si256(),
+				  one	  = _mm256_set1_epi32(1),
+				  allOnes = _mm256_set1_epi32(-1),
+				  half	  = _mm256_set1_epi32(ActorStore::tileUnits / 2),
+				  width	  = _mm256_set1_epi32(batch.width),
+				  height  = _mm256_set1_epi32(batch.height);
+
+	int i = 0;
+	for (; i + 8 <= batch.count; i += 8)
+	{
+		__m256i speed  = _mm256_loadu_si256((const __m256i*)(batch.speed + i));
+		__m256i alive  = _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(batch.alive + i))), zero), allOnes);
+		__m256i active = _mm256_and_si256(alive, _mm256_cmpgt_epi32(speed, zero));
+
+		//an actor moving half a tile or more per tick can pass several centers, that is left to the scalar kernel
+		if (!_mm256_testz_si256(active, _mm256_cmpgt_epi32(speed, _mm256_sub_epi32(half, one))))
+		{
+			moveScalar(batch, i, i + 8);
+			continue;
+		}
+
+		__m256i tileX	  = _mm256_loadu_si256((const __m256i*)(batch.tileX + i)),
+				tileY	  = _mm256_loadu_si256((const __m256i*)(batch.tileY + i)),
+				offsetX	  = _mm256_loadu_si256((const __m256i*)(batch.offsetX + i)),
+				offsetY	  = _mm256_loadu_si256((const __m256i*)(batch.offsetY + i)),
+				direction = _mm256_loadu_si256((const __m256i*)(batch.direction + i)),
+				next	  = _mm256_loadu_si256((const __m256i*)(batch.nextDirection + i));
+
+		__m256i tile  = _mm256_add_epi32(_mm256_mullo_epi32(tileY, width), tileX);
+		__m256i exits = _mm256_and_si256(_mm256_i32gather_epi32((const int*)batch.exits, tile, 1), _mm256_set1_epi32(0xFF));
+
+		auto canLeave = [&](__m256i d) { return _mm256_cmpgt_epi32(_mm256_and_si256(_mm256_srlv_epi32(exits, d), one), zero); };
+		auto turn = [&](__m256i mask) {
+			__m256i differs = _mm256_xor_si256(_mm256_cmpeq_epi32(direction, next), allOnes);
+			direction = _mm256_blendv_epi8(direction, next, _mm256_and_si256(_mm256_and_si256(mask, differs), canLeave(next)));
+		};
+		//up and left are negative, right and left are horizontal
+		__m256i sign, horizontal;
+		auto axis = [&]() {
+			__m256i positive = _mm256_and_si256(_mm256_xor_si256(direction, _mm256_srli_epi32(direction, 1)), one);
+			sign	   = _mm256_sub_epi32(_mm256_slli_epi32(positive, 1), one);
+			horizontal = _mm256_cmpgt_epi32(direction, one);
+		};
+
+		turn(_mm256_and_si256(active, _mm256_cmpeq_epi32(_mm256_or_si256(offsetX, offsetY), zero)));
+		axis();
+
+		__m256i ahead	= _mm256_sign_epi32(_mm256_blendv_epi8(offsetY, offsetX, horizontal), sign);
+		__m256i blocked = _mm256_andnot_si256(canLeave(direction), _mm256_and_si256(active, _mm256_cmpgt_epi32(ahead, allOnes)));
+		__m256i remaining = _mm256_and_si256(_mm256_andnot_si256(blocked, active), speed);
+
+		//to the center
+		__m256i approaching = _mm256_cmpgt_epi32(zero, ahead);
+		__m256i step = _mm256_and_si256(approaching, _mm256_min_epi32(remaining, _mm256_sub_epi32(zero, ahead)));
+		ahead	  = _mm256_add_epi32(ahead, step);
+		remaining = _mm256_sub_epi32(remaining, step);
+
+		__m256i reached = _mm256_and_si256(approaching, _mm256_and_si256(_mm256_cmpeq_epi32(ahead, zero), _mm256_cmpgt_epi32(remaining, zero)));
+		turn(reached);
+		axis();
+		remaining = _mm256_andnot_si256(_mm256_andnot_si256(canLeave(direction), reached), remaining);
+
+		//towards the next tile
+		__m256i moving = _mm256_cmpgt_epi32(remaining, zero);
+		step	  = _mm256_and_si256(moving, _mm256_min_epi32(remaining, _mm256_sub_epi32(half, ahead)));
+		ahead	  = _mm256_add_epi32(ahead, step);
+		remaining = _mm256_sub_epi32(remaining, step);
+
+		__m256i edge = _mm256_and_si256(moving, _mm256_cmpeq_epi32(ahead, half));
+		ahead = _mm256_blendv_epi8(ahead, _mm256_sub_epi32(remaining, half), edge);
+		tileX = _mm256_add_epi32(tileX, _mm256_and_si256(edge, _mm256_and_si256(horizontal, sign)));
+		tileY = _mm256_add_epi32(tileY, _mm256_and_si256(edge, _mm256_andnot_si256(horizontal, sign)));
+		tileX = _mm256_sub_epi32(_mm256_add_epi32(tileX, _mm256_and_si256(_mm256_cmpgt_epi32(zero, tileX), width)),
+								 _mm256_and_si256(_mm256_cmpgt_epi32(tileX, _mm256_sub_epi32(width, one)), width));
+		tileY = _mm256_sub_epi32(_mm256_add_epi32(tileY, _mm256_and_si256(_mm256_cmpgt_epi32(zero, tileY), height)),
+								 _mm256_and_si256(_mm256_cmpgt_epi32(tileY, _mm256_sub_epi32(height, one)), height));
+
+		//the offset along the axis, the other offset snaps to the center, unless the actor was blocked
+		__m256i along = _mm256_sign_epi32(ahead, sign);
+		__m256i newOffsetX = _mm256_blendv_epi8(_mm256_and_si256(horizontal, along), _mm256_andnot_si256(horizontal, offsetX), blocked),
+				newOffsetY = _mm256_blendv_epi8(_mm256_andnot_si256(horizontal, along), _mm256_and_si256(horizontal, offsetY), blocked);
+		offsetX = _mm256_blendv_epi8(offsetX, newOffsetX, active);
+		offsetY = _mm256_blendv_epi8(offsetY, newOffsetY, active);
+
+		_mm256_storeu_si256((__m256i*)(batch.tileX + i), tileX);
+		_mm256_storeu_si256((__m256i*)(batch.tileY + i), tileY);
+		_mm256_storeu_si256((__m256i*)(batch.offsetX + i), offsetX);
+		_mm256_storeu_si256((__m256i*)(batch.offsetY + i), offsetY);
+		_mm256_storeu_si256((__m256i*)(batch.direction + i), direction);
+		_mm256_maskstore_epi32(batch.previousTile + i, alive, tile);
+
+		int entered = _mm256_movemask_ps(_mm256_castsi256_ps(edge));
+		for (int lane = 0; entered; lane++, entered >>= 1)
+			if (entered & 1) batch.enteredTile[i + lane] = 1;
+	}
+	moveScalar(batch, i, batch.count);
+}
+#endif
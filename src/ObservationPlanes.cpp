@@ -0,0 +1,163 @@
+/**
+ * @file ObservationPlanes.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the ObservationPlanes class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "ObservationPlanes.h"
+
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Construct a new Observation Planes:: Observation Planes object, and draws the game.
+ * 		  There is a channel for Pacman and for every ghost in the game.
+ *
+ * @param game 	   - The game that is observed, every game of the same level has the same channels
+ * @param settings - The downsampling and the window around Pacman
+ */
+ObservationPlanes::ObservationPlanes(const GameState& game, const ObservationSettings& settings)
+	: settings(settings)
+{
+	this->settings.downsample = std::max(this->settings.downsample, 1);
+	this->settings.cropWidth  = std::max(this->settings.cropWidth, 0);
+	this->settings.cropHeight = std::max(this->settings.cropHeight, 0);
+
+	const Maze& maze = game.getMaze();
+	int downsample = this->settings.downsample;
+	cellsX = (maze.getWidth() + downsample - 1) / downsample;
+	cellsY = (maze.getHeight() + downsample - 1) / downsample;
+
+	const ActorStore& actors = game.getActors();
+	channelActors.push_back(game.getPlayer());
+	for (int i = 0; i < actors.size(); i++)
+		if (actors.kind[i] == ghostActor)
+			channelActors.push_back(i);
+	channels = pacmanChannel + (int)channelActors.size();
+
+	planes.resize((size_t)channels * cellsX * cellsY);
+	pelletCounts.resize((size_t)cellsX * cellsY);
+	actorCells.resize(channelActors.size());
+	build(game);
+}
+
+/**
+ * @brief Draws every plane from scratch, after the game has been started over.
+ *
+ * @param game - The game
+ */
+void ObservationPlanes::build(const GameState& game)
+{
+	const Maze& maze = game.getMaze();
+	const int area = settings.downsample * settings.downsample;
+
+	std::vector <int> wallCounts(pelletCounts.size(), 0);
+	std::fill(pelletCounts.begin(), pelletCounts.end(), 0);
+	for (int y = 0; y < maze.getHeight(); y++)
+		for (int x = 0; x < maze.getWidth(); x++)
+		{
+			wallCounts[getCell(x, y)] += maze.map2d[y][x] == 1;
+			pelletCounts[getCell(x, y)] += game.hasPellet(x, y);
+		}
+
+	std::fill(planes.begin(), planes.end(), 0);
+	unsigned char* walls = getPlane(wallsChannel);
+	unsigned char* pellets = getPlane(pelletsChannel);
+	for (size_t cell = 0; cell < pelletCounts.size(); cell++)
+	{
+		walls[cell] = wallCounts[cell] * 255 / area;
+		pellets[cell] = pelletCounts[cell] * 255 / area;
+	}
+
+	std::fill(actorCells.begin(), actorCells.end(), -1);
+	drawActors(game);
+}
+
+/**
+ * @brief Draws what has changed during the last step: the cells of the eaten pellets, and the actors that moved to another cell.
+ *
+ * @param game - The game, stepped once since the last build or update
+ */
+void ObservationPlanes::update(const GameState& game)
+{
+	const Maze& maze = game.getMaze();
+	const int area = settings.downsample * settings.downsample;
+
+	unsigned char* pellets = getPlane(pelletsChannel);
+	for (int tile : game.getEatenPellets())
+	{
+		int cell = getCell(tile % maze.getWidth(), tile / maze.getWidth());
+		pellets[cell] = --pelletCounts[cell] * 255 / area;
+	}
+
+	drawActors(game);
+}
+
+/**
+ * @brief Moves every actor to its current cell, in its own channel. An actor that is not alive is not drawn.
+ *
+ * @param game - The game
+ */
+void ObservationPlanes::drawActors(const GameState& game)
+{
+	const ActorStore& actors = game.getActors();
+	for (size_t i = 0; i < channelActors.size(); i++)
+	{
+		int actor = channelActors[i];
+		int cell = actors.alive[actor] ? getCell(actors.tileX[actor], actors.tileY[actor]) : -1;
+		if (cell == actorCells[i]) continue;
+
+		unsigned char* plane = getPlane(pacmanChannel + (int)i);
+		if (actorCells[i] != -1) plane[actorCells[i]] = 0;
+		if (cell != -1)			 plane[cell] = 255;
+		actorCells[i] = cell;
+	}
+}
+
+/**
+ * @brief Writes the observation, getSize() bytes: every channel, row by row. With a window around Pacman,
+ * 		  the cells outside the maze are walls.
+ *
+ * @param game 		  - The game the planes were last updated with
+ * @param observation - Where the observation is written
+ */
+void ObservationPlanes::write(const GameState& game, unsigned char* observation) const
+{
+	if (!settings.cropWidth && !settings.cropHeight)
+	{
+		std::memcpy(observation, planes.data(), planes.size());
+		return;
+	}
+
+	const ActorStore& actors = game.getActors();
+	int player = game.getPlayer(),
+		width = getWidth(),
+		height = getHeight(),
+		center = getCell(actors.tileX[player], actors.tileY[player]),
+		originX = settings.cropWidth ? center % cellsX - width / 2 : 0,		//an axis that is not cropped is not moved
+		originY = settings.cropHeight ? center / cellsX - height / 2 : 0,
+		left = std::min(std::max(-originX, 0), width),			//the columns of the window that are in the maze
+		right = std::max(std::min(cellsX - originX, width), left);
+
+	for (int channel = 0; channel < channels; channel++)
+	{
+		const unsigned char* plane = planes.data() + (size_t)channel * cellsX * cellsY;
+		unsigned char outside = channel == wallsChannel ? 255 : 0;
+		for (int row = 0; row < height; row++, observation += width)
+		{
+			int y = originY + row;
+			if (y < 0 || y >= cellsY)
+			{
+				std::memset(observation, outside, width);
+				continue;
+			}
+			std::memset(observation, outside, left);
+			std::memcpy(observation + left, plane + (size_t)y * cellsX + originX + left, right - left);
+			std::memset(observation + right, outside, width - right);
+		}
+	}
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ObservationPlanes.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the ObservationPlanes class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include "GameState.h"
+
+#include <vector>
+
+/**
+ * @brief How the observations are made. Every cell of an observation covers downsample x downsample tiles.
+ *
+ */
+struct ObservationSettings
+{
+	int downsample = 1;
+	int cropWidth  = 0,		//in cells, a window centered on Pacman, 0 for the whole maze
+		cropHeight = 0;
+};
+
+/**
+ * @brief The channels of an observation, there is one channel for every ghost, starting at ghostsChannel.
+ *
+ */
+enum ObservationChannel
+{
+	wallsChannel = 0,
+	pelletsChannel = 1,
+	pacmanChannel = 2,
+	ghostsChannel = 3
+};
+
+/**
+ * @class ObservationPlanes
+ * @brief Draws a game into uint8 planes on the CPU, one plane per channel, for learning agents.
+ * 		  A cell is 255 when an actor is on one of its tiles, and for walls and pellets the share of its tiles that have one.
+ * 		  The planes are kept for the whole maze and only the cells that changed since the last update are drawn:
+ * 		  the pellets eaten during the step and the cells the actors left and entered.
+ * 		  Writing an observation copies the planes, or the window around Pacman.
+ */
+class ObservationPlanes
+{
+private:
+	ObservationSettings settings;
+	int					cellsX,
+						cellsY,
+						channels;
+
+	std::vector <unsigned char> planes;		 //channel by channel, row by row, for the whole maze
+	std::vector <int>			pelletCounts;	 //per cell, the tiles with a pellet
+	std::vector <int>			channelActors,	 //per actor channel, the actor drawn in it
+								actorCells;		 //per actor channel, the cell the actor was drawn in, -1 for none
+public:
+	ObservationPlanes(const GameState& game, const ObservationSettings& settings);
+
+	void build(const GameState& game);
+	void update(const GameState& game);
+	void write(const GameState& game, unsigned char* observation) const;
+
+	int getChannels() const { return channels; }
+	int getWidth() const	{ return settings.cropWidth ? settings.cropWidth : cellsX; }
+	int getHeight() const	{ return settings.cropHeight ? settings.cropHeight : cellsY; }
+	int getSize() const		{ return channels * getWidth() * getHeight(); }
+
+private:
+	int  getCell(int x, int y) const { return (y / settings.downsample) * cellsX + x / settings.downsample; }
+	unsigned char* getPlane(int channel) { return planes.data() + (size_t)channel * cellsX * cellsY; }
+	void drawActors(const GameState& game);
+};
@@ -0,0 +1,49 @@
+/**
+ * @file OccupancyGrid.cpp
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Source code for the OccupancyGrid class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "OccupancyGrid.h"
+
+/**
+ * @brief Construct a new Occupancy Grid:: Occupancy Grid object, with no actors on any tile.
+ * 
+ * @param maze - The maze the actors are in
+ */
+OccupancyGrid::OccupancyGrid(const Maze* maze)
+	: m_Maze(maze),
+	  stamp(1)
+{
+	heads.assign((size_t)m_Maze->getWidth() * m_Maze->getHeight(), -1);
+	stamps.assign(heads.size(), 0);
+}
+
+/**
+ * @brief Puts every living actor on the list of its tile.
+ * 
+ * @param store - The actors
+ */
+void OccupancyGrid::build(const ActorStore& store)
+{
+	if (++stamp == 0)	//the stamps have wrapped around, old stamps could look new
+	{
+		stamps.assign(stamps.size(), 0);
+		stamp = 1;
+	}
+
+	next.resize(store.size());
+	for (int i = 0; i < store.size(); i++)
+	{
+		if (!store.alive[i]) continue;
+
+		int tile = m_Maze->getTileIndex(store.tileX[i], store.tileY[i]);
+		next[i] = getFirst(tile);
+		heads[tile] = i;
+		stamps[tile] = stamp;
+	}
+}
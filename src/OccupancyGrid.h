@@ -0,0 +1,39 @@
+/**
+ * @file OccupancyGrid.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief Header file for the OccupancyGrid class
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include "ActorStore.h"
+#include "Maze.h"
+
+#include <vector>
+
+/**
+ * @class OccupancyGrid
+ * @brief Knows which actors are on every tile. Every tile has a list of actors, linked through the actors,
+ * 		  so that rebuilding the grid only touches the actors and finding the actors on a tile takes constant time.
+ * 		  The lists are marked with the build they belong to, so the tiles never have to be cleared.
+ */
+class OccupancyGrid
+{
+private:
+	const Maze* m_Maze;
+
+	std::vector <int>		   heads;	//per tile, the first actor on it
+	std::vector <unsigned int> stamps;	//per tile, the build the head belongs to
+	std::vector <int>		   next;	//per actor, the next actor on the same tile, -1 for none
+	unsigned int			   stamp;
+public:
+	OccupancyGrid(const Maze* maze);
+
+	void build(const ActorStore& store);
+
+	int getFirst(int tile) const { return stamps[tile] == stamp ? heads[tile] : -1; }
+	int getNext(int actor) const { return next[actor]; }
+};
@@ -9,166 +9,76 @@
  * 
  */
 #include "Pellets.h"
-#include "Texture.h"
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-#include <iostream>
 
 /**
- * @brief Construct a new Pellets:: Pellets object
+ * @brief Construct a new Pellets:: Pellets object. Nothing is made for OpenGL, so the pellets can be made on another thread.
  * 
- * @param maze 		- The maze the pellets are to be drawn in
- * @param shader 	- The Pellet's shader
- * @param renderer 	- The Pellet's renderer
- * @param player 	- The player responsible for "eating" the pellets. 
- * 
- * @see generatePellets()
+ * @param maze 		   - The maze holding the pellets
+ * @param mazeRenderer - The renderer drawing the maze, and the pellets with it
+ * @param actors 	   - The actors, holding the player
+ * @param player 	   - The index of the player responsible for "eating" the pellets. 
  */
-Pellets::Pellets(Maze* maze, Shader* shader, Renderer* renderer,MovableObject* player)
-	:	m_Maze(maze),
-		m_Renderer(renderer),
-		m_Shader(shader),
-		m_Player(player),
-		allPelletsEaten(false)
+Pellets::Pellets(Maze* maze, MazeRenderer* mazeRenderer, ActorStore* actors, int player)
+	:	allPelletsEaten(false),
+		m_Maze(maze),
+		m_MazeRenderer(mazeRenderer),
+		m_Actors(actors),
+		player(player),
+		events(nullptr)
 {
-	generatePellets();
 	remainingPellets = m_Maze->getPelletCount();
 }
 
 /**
- * @brief Destroy the Pellets:: Pellets object
- * 
- */
-Pellets::~Pellets()
-{
-		
-	free(m_Maze);
-	free(m_Renderer);
-	free(m_Shader);
-	free(pelletsVAO);
-	free(pelletsVBO);
-	free(pelletsVBLayout);
-	free(pelletsIBO);
-	free(pelletsTexture);
-	free(m_Player);
-}
-
-/**
- * @brief Generates the pellets, from the creation of the vertices and indices
- * 		  to the OpenGL code.
- * @see makeVertices();
- * @see makePelletsIndices();
- */
-void Pellets::generatePellets()
-{
-	makeVertices();
-	makePelletsIndices();
-
-
-
-	pelletsVAO = new VertexArray;
-	pelletsVAO->Bind();
-	pelletsVBO = new VertexBuffer(&pelletVertices[0], pelletVertices.size() * sizeof(glm::vec3));
-	pelletsVBO->Bind();
-	pelletsVBLayout = new VertexBufferLayout;
-	pelletsVBLayout->Push<float>(3);
-	pelletsVBLayout->Push<float>(3);
-	pelletsVAO->AddBuffer(*pelletsVBO, *pelletsVBLayout);
-
-	pelletsIBO = new IndexBuffer(&pelletsIndices[0], pelletsIndices.size());
-
-	m_Shader->createShaderProgram();
-	//m_Shader->setUniform4f("u_Color",.1f, .1f, .1f, 1.f);
-	
-	pelletsTexture = new Texture("res/smallPellet.png");
-	pelletsTexture->Bind(0);
-	m_Shader->setUniform1i("u_Texture", 0);
-}
-
-/**
- * @brief Generates the indices for each pellet.
- * 
+ * @brief Checks wheter or not a pellet has been "eaten" by pacman (the player).
+ *		  If the pellet has been eaten, the chunk holding it is rebuilt without it, and a pelletEaten event is sent
  */
-void Pellets::makePelletsIndices()
+void Pellets::hasBeenEaten()
 {
-
-	int indicesHeigth = m_Maze->getHeight(); int indicesWidth = m_Maze->getWidth();
-
-	for (int i = 0; i < indicesHeigth; i++) {
-		for (int j = 0; j < indicesWidth; j++) {
-			if (i < m_Maze->map2d.size() && j < m_Maze->map2d[i].size() && m_Maze->map2d[i][j] == 0) {
-
-				int k = (i * indicesWidth + j) * 4;
-				pelletsIndices.push_back(k);
-				pelletsIndices.push_back(k + 1);
-				pelletsIndices.push_back(k + 2);
-				pelletsIndices.push_back(k + 1);
-				pelletsIndices.push_back(k + 2);
-				pelletsIndices.push_back(k + 3);
-
-			}
+	int x = m_Actors->tileX[player], y = m_Actors->tileY[player];
+	if (m_Maze->eatPellet(x, y))
+	{
+		m_MazeRenderer->updateTile(x, y);
+		eatenTiles.push_back(y * m_Maze->getWidth() + x);
+		if (events) events->push({ pelletEaten, player, y * m_Maze->getWidth() + x });
+		if (--remainingPellets == 0)
+		{
+			allPelletsEaten = true;
+			if (events) events->push({ levelCleared, player, -1 });
 		}
 	}
 }
 
 /**
- * @brief Draws all pellets. 
- * @see hasBeenEaten();
+ * @brief Puts back every eaten pellet, for playing the level again.
+ * 		  Only the chunks holding an eaten pellet are rebuilt, and only when they are drawn.
  */
-void Pellets::draw()
+void Pellets::reset()
 {
-	pelletsTexture->Bind(0);
-	hasBeenEaten();
-	m_Shader->Bind();
-	m_Shader->camera(m_Maze->getWidth(), m_Maze->getHeight());
-	m_Renderer->Draw(pelletsVAO, pelletsIBO, m_Shader);
-}
+	remainingPellets += m_Maze->restorePellets();	//not the ones put back by updateTile() already, or made a wall since
+	for (int tile : eatenTiles)
+		m_MazeRenderer->updateTile(tile % m_Maze->getWidth(), tile / m_Maze->getWidth());
+	eatenTiles.clear();
 
-/**
- * @brief Makes all the vertices for the pellets, including positions and texture coordinates. 
- * 
- */
-void Pellets::makeVertices()
-{
-		for (int y = 0; y < m_Maze->getHeight(); y++) {
-			for (int x = 0; x < m_Maze->getWidth(); x++) {
-				pelletVertices.push_back(glm::vec3(x, y, 0.f));     //position
-				pelletVertices.push_back(glm::vec3(0.f, 1.f, 0.f)); //texture
-				
-				pelletVertices.push_back(glm::vec3(x+1, y, 0.f));   //position
-				pelletVertices.push_back(glm::vec3(1.f, 1.f, 0.f)); //texture
-				
-				pelletVertices.push_back(glm::vec3(x, y+1, 0.f));   //position
-				pelletVertices.push_back(glm::vec3(0.f, 0.f, 0.f)); //texture
-				
-				pelletVertices.push_back(glm::vec3(x+1, y+1, 0.f)); //position
-				pelletVertices.push_back(glm::vec3(1.f, 0.f, 0.f)); //texture
-			}
-		}
+	allPelletsEaten = remainingPellets == 0;
 }
 
 /**
- * @brief Checks wheter or not a pellet has been "eaten" by pacman (the player).
- *		  If the pellet has been eaten, the texture for the given pellet is set to 0
+ * @brief Counts the pellet of a tile that has been added or removed, after the tile has been changed with Maze::setTile().
+ * 		  The tile's chunk is rebuilt by the MazeRenderer, see CampaignLevel::setTile().
+ * 
+ * @param x 		- The horizontal tile
+ * @param y 		- The vertical tile
+ * @param hadPellet - Whether the tile had a pellet before it was changed
  */
-void Pellets::hasBeenEaten()
+void Pellets::updateTile(int x, int y, bool hadPellet)
 {
-	if (m_Maze->map2d[round(m_Player->posY)][round(m_Player->posX)] == 0)
-	{
-		m_Maze->map2d[round(m_Player->posY)][round(m_Player->posX)] = 9;
-		for (int y = 0; y < m_Maze->getHeight(); y++)
-			for (int x = 0; x < m_Maze->getWidth(); x++)
-				if (round(m_Player->posY) == y && round(m_Player->posX) == x)
-				{
-					int i = (y * m_Maze->getWidth() + x) * 8;
-					pelletVertices[i + 1] = glm::vec3(0.f); //sets the textures for the "eaten" object to null.
-					pelletVertices[i + 3] = glm::vec3(0.f);
-					pelletVertices[i + 5] = glm::vec3(0.f);
-					pelletVertices[i + 7] = glm::vec3(0.f);
-				}
-		pelletsVAO->changeData(pelletsVBO,&pelletVertices[0], pelletVertices.size() * sizeof(glm::vec3));
-		if (--remainingPellets == 0)
-			allPelletsEaten = true;
-	}
+	bool pellet = m_Maze->hasPellet(x, y);
+	if (pellet == hadPellet)
+		return;
+
+	remainingPellets += pellet ? 1 : -1;
+	allPelletsEaten = remainingPellets == 0;
+	if (allPelletsEaten && events)	//the last pellet was edited away
+		events->push({ levelCleared, player, -1 });
 }
@@ -10,43 +10,36 @@
  */
 #pragma once
 #include "Maze.h"
-#include "Pacman.h"
-#include "Texture.h"
+#include "MazeRenderer.h"
+#include "ActorStore.h"
+#include "GameEvents.h"
 
 
 /**
  * @class Pellets
- * @brief The class handling everything related to pellets. 
+ * @brief The class handling everything related to pellets. They are drawn with the maze, by the chunks of the
+ * 		  MazeRenderer, which are told about every pellet that is eaten or put back.
  */
 class Pellets
 {
 private:
 	int  remainingPellets;
 	bool allPelletsEaten;
-	std::vector <unsigned int>	pelletsIndices;
-	std::vector <glm::vec3>		pelletVertices;
 	
 	Maze*				m_Maze;
-	Renderer*			m_Renderer;
-	Shader*				m_Shader;
+	MazeRenderer*		m_MazeRenderer;
+	std::vector <int>	eatenTiles;	//every tile eaten since the start, see reset()
 
-	VertexArray*		pelletsVAO;
-	VertexBuffer*		pelletsVBO;
-	VertexBufferLayout* pelletsVBLayout;
-	IndexBuffer*	    pelletsIBO;
-	Texture*			pelletsTexture;
-
-	MovableObject*		m_Player;
+	ActorStore*			m_Actors;
+	int					player;		//the actor eating the pellets
+	GameEventRing*		events;		//where the eaten pellets and the cleared level are sent, if anywhere
 public:
-	Pellets(Maze* maze, Shader* shader, Renderer* renderer, MovableObject* player);
-	~Pellets();
+	Pellets(Maze* maze, MazeRenderer* mazeRenderer, ActorStore* actors, int player);
 
-	void generatePellets();
-	void makePelletsIndices();
-	void draw();
-	void makeVertices();
 	bool allPelletsGone() { return allPelletsEaten; }
 	int  getScore() { return remainingPellets; }
-private:
 	void hasBeenEaten();
+	void reset();
+	void updateTile(int x, int y, bool hadPellet);
+	void setEventRing(GameEventRing* ring) { events = ring; }
 };
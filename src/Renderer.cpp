@@ -23,10 +23,27 @@ void Renderer::Draw(VertexArray* va, IndexBuffer* ib, Shader* shader) const
 	shader->Bind();
 	va->Bind();
 	ib->Bind();
-	glDrawElements(GL_TRIANGLES, ib->getCount(), GL_UNSIGNED_INT, nullptr);
+	glDrawElements(GL_TRIANGLES, ib->getCount(), ib->getType(), nullptr);
 
 }
 
+/**
+ * @brief Draws an object several times in one call, once for every instance in the VertexArray's instance buffer.
+ * 
+ * @param va 			- The object to be drawn's VertexArray, with the instance buffer.
+ * @param ib 			- The object to be drawn's IndexBuffer.
+ * @param shader 		- The object to be drawn's Shader.
+ * @param instances 	- The amount of instances drawn.
+ * @param firstInstance - The first instance drawn in the instance buffer.
+ */
+void Renderer::DrawInstanced(VertexArray* va, IndexBuffer* ib, Shader* shader, unsigned int instances, unsigned int firstInstance) const
+{
+	shader->Bind();
+	va->Bind();
+	ib->Bind();
+	glDrawElementsInstancedBaseInstance(GL_TRIANGLES, ib->getCount(), ib->getType(), nullptr, instances, firstInstance);
+}
+
 /**
  * @brief Clears the screen in RGB colors.
  * 
@@ -22,5 +22,6 @@ class Renderer
 {
 public:
 	void Draw(VertexArray* va, IndexBuffer* ib, Shader* shader) const;
+	void DrawInstanced(VertexArray* va, IndexBuffer* ib, Shader* shader, unsigned int instances, unsigned int firstInstance = 0) const;
 	void Clear(float f0, float f1, float f2, float f3) const;
 };
@@ -13,6 +13,7 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -36,7 +37,53 @@ ScenarioLoader::ScenarioLoader(const std::string& filepath)
 			mazeMap.push_back(temp);	//storing it in the mazeMap vector
 		}
 	}
+	complete = (bool)levelFile;	//a failed read leaves the stream failed, and 0 in the tile
+}
+
+/**
+ * @brief Construct a new Scenario Loader:: Scenario Loader object from a map that is already in memory,
+ * 		  such as one made by the MazeGenerator.
+ * 
+ * @param horizontalSize - The width of the map
+ * @param verticalSize 	 - The height of the map
+ * @param map 			 - The map, row by row
+ */
+ScenarioLoader::ScenarioLoader(int horizontalSize, int verticalSize, std::vector <int> map)
+	: horizontalSize(horizontalSize),
+	  verticalSize(verticalSize),
+	  complete(true),
+	  mazeMap(std::move(map))
+{
+}
+
+/**
+ * @brief Saves the currently stored "map" to file, in the same format it is loaded from.
+ * 
+ * @param filepath - The path to the file the level is saved to.
+ * @return true if the file was written
+ */
+bool ScenarioLoader::saveMazeMap(const std::string& filepath)
+{
+	std::ofstream levelFile(filepath);
+	if (!levelFile)
+	{
+		std::cout << "Warning: Could not open " << filepath << " for writing!\n";
+		return false;
+	}
 
+	levelFile << horizontalSize << 'x' << verticalSize << '\n';
+	std::string row;
+	for (int i = 0; i < verticalSize; i++)
+	{
+		row.clear();
+		for (int j = 0; j < horizontalSize; j++)
+		{
+			if (j) row += ' ';
+			row += std::to_string(mazeMap[i * horizontalSize + j]);
+		}
+		levelFile << row << '\n';
+	}
+	return (bool)levelFile;
 }
 
 /**
@@ -12,9 +12,6 @@
 #include <string>
 #include <vector>
 
-#include <GL/glew.h>
-#include <glm/glm.hpp>
-
 /**
  * @class ScenarioLoader
  * @brief  Handles the loading and saving of the content in the level files. 
@@ -23,13 +20,17 @@ class ScenarioLoader
 {
 private:
 	int horizontalSize, verticalSize;
+	bool complete;	//false if the file ended, or had something else than a number, before the last tile
 public:
 	std::vector <int> mazeMap;	//will hold data regarding the map of the maze
 	ScenarioLoader(const std::string& filepath);
+	ScenarioLoader(int horizontalSize, int verticalSize, std::vector <int> map);
 	void printMazeMap();
+	bool saveMazeMap(const std::string& filepath);
 	int getHorizontalSize() { return horizontalSize; }
 	int getVerticalSize() { return verticalSize; }
 
 	int getValue(const int i) { return mazeMap[i]; }
 	int getVecSize() { return mazeMap.size(); }
+	bool isComplete() const { return complete; }
 };
\ No newline at end of file
@@ -9,6 +9,7 @@
  * 
  */
 #include "Shader.h"
+#include "Camera.h"
 
 #include <string>
 #include <fstream>
@@ -32,6 +33,7 @@ enum class ShaderType {
  * @param filepath - Filepath to the file containing the shaders
  */
 Shader::Shader(const std::string& filepath)
+	: shaderProgram(0)
 {
 	std::ifstream shaderFile(filepath);
 
@@ -119,6 +121,8 @@ unsigned int Shader::createShaderProgram()
 	createVertexShader();		//creates the vertex shader
 	createFragmentShader();		//creates the fragment shader
 
+	if (shaderProgram)			//a program made by an earlier call would otherwise leak
+		glDeleteProgram(shaderProgram);
 	shaderProgram = glCreateProgram();
 
 	glAttachShader(shaderProgram, vertexShader);
@@ -163,6 +167,23 @@ void Shader::camera(int horizontalSize, int verticalSize)
 
 }
 
+/**
+ * @brief Sets the camera for the shader, showing only the part of the maze the camera sees.
+ * 
+ * @param camera - The camera
+ */
+void Shader::camera(const Camera& camera)
+{
+	glm::mat4 projection = camera.getProjection();
+
+	glm::mat4 view = glm::lookAt(glm::vec3(0, 0, 1), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	GLuint projmat = glGetUniformLocation(shaderProgram, "u_ProjectionMat");
+	GLuint viewmat = glGetUniformLocation(shaderProgram, "u_ViewMat");
+
+	glUniformMatrix4fv(projmat, 1, GL_FALSE, glm::value_ptr(projection));
+	glUniformMatrix4fv(viewmat, 1, GL_FALSE, glm::value_ptr(view));
+}
+
 /**
  * @brief Binds (selects) the current shaderProgram.
  * 
@@ -13,6 +13,8 @@
 #include <string>
 #include <glm/glm.hpp>
 
+class Camera;
+
 /**
  * @class Shader
  * @brief Boilerplate OpenGL code regarding the creation, and administration of shaders.  
@@ -32,6 +34,7 @@ public:
 	void createFragmentShader();
 	unsigned int createShaderProgram();
 	void camera(int horizontalSize, int verticalSize);
+	void camera(const Camera& camera);
 
 	void Bind() const;
 	void Unbind() const;
@@ -22,11 +22,13 @@
  */
 Texture::Texture(const std::string& filepath)
 	:	m_RendererID(0),
+		m_Target(GL_TEXTURE_2D),
 		m_FilePath(filepath),
 		m_LocalBuffer(nullptr),
 		m_Width(0),
 		m_Height(0),
-		m_BPP(0)
+		m_BPP(0),
+		m_Layers(1)
 {
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -49,6 +51,61 @@ Texture::Texture(const std::string& filepath)
 		stbi_image_free(m_LocalBuffer);
 }
 
+/**
+ * @brief Construct a new Texture:: Texture object holding an array of images, one layer per image, in the order of the filepaths.
+ * 		  The images are sampled with a sampler2DArray, so any amount of them takes a single texture slot.
+ * 
+ * @param filepaths - The filepaths to the files containing the images, which must all be as large as the first
+ */
+Texture::Texture(const std::vector <std::string>& filepaths)
+	:	m_RendererID(0),
+		m_Target(GL_TEXTURE_2D_ARRAY),
+		m_FilePath(filepaths.empty() ? "" : filepaths[0]),
+		m_LocalBuffer(nullptr),
+		m_Width(0),
+		m_Height(0),
+		m_BPP(0),
+		m_Layers((int)filepaths.size())
+{
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	glGenTextures(1, &m_RendererID);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	stbi_set_flip_vertically_on_load(1);
+	for (int layer = 0; layer < m_Layers; layer++)
+	{
+		int width, height;
+		m_LocalBuffer = stbi_load(filepaths[layer].c_str(), &width, &height, &m_BPP, 4);
+		if (!m_LocalBuffer)
+		{
+			std::cout << "Could not load the texture " << filepaths[layer] << '\n';
+			continue;
+		}
+
+		if (m_Width == 0)	//the first image that loads decides the size
+		{
+			m_Width = width;
+			m_Height = height;
+			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, m_Width, m_Height, m_Layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		}
+		if (width == m_Width && height == m_Height)
+			glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, m_Width, m_Height, 1, GL_RGBA, GL_UNSIGNED_BYTE, m_LocalBuffer);
+		else
+			std::cout << "The texture " << filepaths[layer] << " is " << width << "x" << height << ", not "
+					  << m_Width << "x" << m_Height << " like the first image, and is left out\n";
+		stbi_image_free(m_LocalBuffer);
+	}
+	m_LocalBuffer = nullptr;
+	Unbind();
+}
+
 /**
  * @brief Destroy the Texture:: Texture object
  * 
@@ -66,7 +123,7 @@ Texture::~Texture()
 void Texture::Bind(unsigned int slot) const
 {
 	glActiveTexture(GL_TEXTURE0 + slot);
-	glBindTexture(GL_TEXTURE_2D, m_RendererID);
+	glBindTexture(m_Target, m_RendererID);
 }
 
 /**
@@ -75,5 +132,5 @@ void Texture::Bind(unsigned int slot) const
  */
 void Texture::Unbind() const
 {
-	glBindTexture(GL_TEXTURE_2D,0);
+	glBindTexture(m_Target, 0);
 }
@@ -10,20 +10,24 @@
  */
 #pragma once
 #include <string>
+#include <vector>
 
 /**
  * @class Texture
  * @brief Boilerplate OpenGL code for handling texture. 
+ * 		  A texture is one image, or an array of images of the same size (layers) that are bound and sampled as one texture.
  */
 class Texture
 {
 private:
 	unsigned int m_RendererID;
+	unsigned int m_Target;	//GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY
 	std::string m_FilePath;
 	unsigned char* m_LocalBuffer;
-	int m_Width, m_Height, m_BPP;
+	int m_Width, m_Height, m_BPP, m_Layers;
 public:
 	Texture(const std::string& filepath);
+	Texture(const std::vector <std::string>& filepaths);
 	~Texture();
 
 	void Bind(unsigned int slot = 0) const;
@@ -31,6 +35,7 @@ public:
 
 	int getWidth() const { return m_Width; }
 	int getHeight() const { return m_Height; }
+	int getLayers() const { return m_Layers; }
 };
 
 
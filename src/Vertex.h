@@ -0,0 +1,72 @@
+/**
+ * @file Vertex.h
+ * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
+ * @brief The vertex formats used by the meshes, and their layouts
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#pragma once
+#include "VertexBufferLayout.h"
+
+#include <GL/glew.h>
+
+/**
+ * @brief A vertex of the maze's walls. The position is relative to the chunk, 
+ * 		  which is never more than MazeChunk::size tiles.
+ */
+struct MazeVertex
+{
+	GLushort position[2];
+};
+
+template<>
+struct VertexBufferLayout<MazeVertex>
+{
+	static constexpr VertexBufferElement elements[] = {
+		VERTEX_BUFFER_ELEMENT(MazeVertex, position, false)
+	};
+};
+static_assert(isTightVertexLayout<MazeVertex>(), "The MazeVertex layout does not match the struct");
+
+/**
+ * @brief A vertex of a textured square, such as a pellet or an actor. Positions are in tiles,
+ * 		  the texture coordinates are normalized so that 65535 is 1.
+ */
+struct TexturedVertex
+{
+	GLushort position[2];
+	GLushort texCoord[2];
+};
+
+template<>
+struct VertexBufferLayout<TexturedVertex>
+{
+	static constexpr VertexBufferElement elements[] = {
+		VERTEX_BUFFER_ELEMENT(TexturedVertex, position, false),
+		VERTEX_BUFFER_ELEMENT(TexturedVertex, texCoord, true)
+	};
+};
+static_assert(isTightVertexLayout<TexturedVertex>(), "The TexturedVertex layout does not match the struct");
+
+/**
+ * @brief What changes from one actor to the next when the actors of a kind are drawn with one instanced call.
+ * 		  The actor's square itself is a TexturedVertex mesh shared by every instance.
+ */
+struct ActorInstance
+{
+	GLfloat position[2];	//in tiles, with the actor's offset into the next tile
+	GLfloat sprite;			//the layer of the kind's sprites, in their array texture
+};
+
+template<>
+struct VertexBufferLayout<ActorInstance>
+{
+	static constexpr VertexBufferElement elements[] = {
+		VERTEX_BUFFER_ELEMENT(ActorInstance, position, false),
+		VERTEX_BUFFER_ELEMENT(ActorInstance, sprite, false)
+	};
+};
+static_assert(isTightVertexLayout<ActorInstance>(), "The ActorInstance layout does not match the struct");
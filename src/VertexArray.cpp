@@ -30,24 +30,25 @@ VertexArray::~VertexArray()
 }
 
 /**
- * @brief Combines a VertexBuffer and a VertexBufferLayout and adds it to the VertexArray
+ * @brief Sets up the attributes of a VertexBuffer, in the order of the elements.
  * 
  * @param vb 		- VertexBuffer containing the data
- * @param layout 	- VertexBufferaLayout containing the information as to how the information is to be interpreted. 
+ * @param elements 	- How the information is to be interpreted
+ * @param count 	- The amount of elements
+ * @param stride 	- The size of one vertex
  */
-void VertexArray::AddBuffer(const VertexBuffer& vb, const VertexBufferLayout& layout)
+void VertexArray::addElements(const VertexBuffer& vb, const VertexBufferElement* elements, unsigned int count, unsigned int stride,
+							  unsigned int firstAttribute, unsigned int divisor)
 {
 	Bind();
 	vb.Bind();
-	const auto& elements = layout.getElements();
-	unsigned int offset = 0;
-	for (unsigned int i = 0; i < elements.size(); i++)
+	for (unsigned int i = 0; i < count; i++)
 	{
 		const auto& element = elements[i];
-		glEnableVertexAttribArray(i);
-		glVertexAttribPointer(i, element.count, element.type, element.normalized,
-			layout.getStride(), (const void*)offset);
-		offset += element.count * VertexBufferElement::getSizeOfType(element.type);
+		glEnableVertexAttribArray(firstAttribute + i);
+		glVertexAttribPointer(firstAttribute + i, element.count, element.type, element.normalized,
+			stride, (const void*)(std::size_t)element.offset);
+		glVertexAttribDivisor(firstAttribute + i, divisor);	//0 is per vertex, 1 is per instance
 	}
 }
 
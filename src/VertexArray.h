@@ -24,10 +24,42 @@ private:
 public:
 	VertexArray();
 	~VertexArray();
-	void AddBuffer(const VertexBuffer& vb, const VertexBufferLayout& layout);
+
+	/**
+	 * @brief Combines a VertexBuffer with the layout of its vertex struct, and adds it to the VertexArray.
+	 * 
+	 * @tparam Vertex - The vertex struct the buffer holds, which must have a VertexBufferLayout
+	 * @param vb 	  - VertexBuffer containing the data
+	 */
+	template<typename Vertex>
+	void AddBuffer(const VertexBuffer& vb)
+	{
+		static_assert(isTightVertexLayout<Vertex>(), "The vertex layout does not match the vertex struct");
+		const auto& elements = VertexBufferLayout<Vertex>::elements;
+		addElements(vb, elements, sizeof(elements) / sizeof(VertexBufferElement), sizeof(Vertex));
+	}
+	
+	/**
+	 * @brief Adds a VertexBuffer with one vertex per instance, after the attributes of the per vertex buffers.
+	 * 
+	 * @tparam Vertex 		  - The struct the buffer holds per instance, which must have a VertexBufferLayout
+	 * @param vb 			  - VertexBuffer containing the data
+	 * @param firstAttribute  - The attribute location of the struct's first member
+	 */
+	template<typename Vertex>
+	void AddInstanceBuffer(const VertexBuffer& vb, unsigned int firstAttribute)
+	{
+		static_assert(isTightVertexLayout<Vertex>(), "The vertex layout does not match the vertex struct");
+		const auto& elements = VertexBufferLayout<Vertex>::elements;
+		addElements(vb, elements, sizeof(elements) / sizeof(VertexBufferElement), sizeof(Vertex), firstAttribute, 1);
+	}
 	
 	void Bind() const;
 	void Unbind() const;
 	void changeData(VertexBuffer* VBO, const void* data, unsigned int size);
+
+private:
+	void addElements(const VertexBuffer& vb, const VertexBufferElement* elements, unsigned int count, unsigned int stride,
+					 unsigned int firstAttribute = 0, unsigned int divisor = 0);
 };
 
@@ -57,4 +57,17 @@ void VertexBuffer::updateBuffer(const void* data, unsigned int size)
 {
 	Bind();
 	glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+}
+
+/**
+ * @brief Replaces part of the buffer's data, without reallocating the buffer.
+ * 
+ * @param offset - Where the new data starts, in bytes
+ * @param data 	 - The new data
+ * @param size 	 - The size of the new data in bytes
+ */
+void VertexBuffer::updateBufferRange(unsigned int offset, const void* data, unsigned int size)
+{
+	Bind();
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
 }
\ No newline at end of file
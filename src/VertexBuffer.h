@@ -24,5 +24,6 @@ public:
 	void Bind() const;
 	void Unbind() const;
 	void updateBuffer(const void* data, unsigned int size);
+	void updateBufferRange(unsigned int offset, const void* data, unsigned int size);
 };
 
@@ -1,7 +1,7 @@
 /**
  * @file VertexBufferLayout.h
  * @author Sebastian Lindtvedt (lindtvedt.sebastian@gmail.com)
- * @brief Header file for the VertexBufferElement
+ * @brief Header file for the VertexBufferElement and the VertexBufferLayouts
  * @version 0.1
  * @date 2020-10-12
  * 
@@ -10,8 +10,22 @@
  */
 #pragma once
 
-#include <vector>
+#include <cstddef>
 #include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+/**
+ * @brief A 16 bit float, as used by GL_HALF_FLOAT attributes.
+ * 
+ */
+struct HalfFloat
+{
+	GLushort bits;
+
+	HalfFloat() : bits(0) {}
+	HalfFloat(float value) : bits(glm::packHalf1x16(value)) {}
+};
 
 /**
  * @brief Struct regarding a VertexBufferElement
@@ -22,59 +36,106 @@ struct VertexBufferElement
 	unsigned int type;
 	unsigned int count;
 	unsigned char normalized;
+	unsigned int offset;	//bytes from the start of the vertex
 
-	static unsigned int getSizeOfType(unsigned int type)
+	static constexpr unsigned int getSizeOfType(unsigned int type)
 	{
 		switch (type)
 		{
 			case GL_FLOAT:				return 4;
 			case GL_UNSIGNED_INT:		return 4;
+			case GL_HALF_FLOAT:			return 2;
+			case GL_SHORT:				return 2;
+			case GL_UNSIGNED_SHORT:		return 2;
+			case GL_BYTE:				return 1;
 			case GL_UNSIGNED_BYTE: 	    return 1;
 		}
 		return 0;
 	}
+
+	constexpr unsigned int getSize() const { return count * getSizeOfType(type); }
 };
 
 /**
- * @class VertexBufferLayout
- * @brief Boilerplate OpenGL code for handling Vertex buffer layouts. 
+ * @brief The OpenGL type of a vertex attribute's components. Only the types below can be used in vertices.
+ * 
  */
-class VertexBufferLayout
+template<typename T> struct VertexComponentType;
+template<> struct VertexComponentType<GLfloat>	 { static constexpr unsigned int value = GL_FLOAT; };
+template<> struct VertexComponentType<HalfFloat> { static constexpr unsigned int value = GL_HALF_FLOAT; };
+template<> struct VertexComponentType<GLuint>	 { static constexpr unsigned int value = GL_UNSIGNED_INT; };
+template<> struct VertexComponentType<GLshort>	 { static constexpr unsigned int value = GL_SHORT; };
+template<> struct VertexComponentType<GLushort>	 { static constexpr unsigned int value = GL_UNSIGNED_SHORT; };
+template<> struct VertexComponentType<GLbyte>	 { static constexpr unsigned int value = GL_BYTE; };
+template<> struct VertexComponentType<GLubyte>	 { static constexpr unsigned int value = GL_UNSIGNED_BYTE; };
+
+/**
+ * @brief The component type and amount of components of a vertex struct's member:
+ * 		  a single value, an array or a glm vector.
+ * 
+ */
+template<typename T>
+struct VertexAttribute
 {
-private:
-	std::vector<VertexBufferElement> m_Elements;
-	unsigned int m_Stride;
-public:
-	VertexBufferLayout()
-		: m_Stride(0) {}
+	using Component = T;
+	static constexpr unsigned int count = 1;
+};
 
-	template<typename T>
-	void Push(unsigned int count)
-	{
-		static_assert(false);
-	}
+template<typename T, std::size_t N>
+struct VertexAttribute<T[N]>
+{
+	using Component = T;
+	static constexpr unsigned int count = N;
+};
 
-	template<>
-	void Push<float>(unsigned int count)
-	{
-		m_Elements.push_back({ GL_FLOAT,count,GL_FALSE });
-		m_Stride += count * VertexBufferElement::getSizeOfType(GL_FLOAT);
-	}
+template<glm::length_t L, typename T, glm::qualifier Q>
+struct VertexAttribute<glm::vec<L, T, Q>>
+{
+	using Component = T;
+	static constexpr unsigned int count = L;
+};
 
-	template<>
-	void Push<unsigned int>(unsigned int count)
-	{
-		m_Elements.push_back({ GL_UNSIGNED_INT,count,GL_FALSE });
-		m_Stride += count * VertexBufferElement::getSizeOfType(GL_UNSIGNED_INT);
-	}
+/**
+ * @brief Makes the element for one member of a vertex struct.
+ * 
+ * @param offset 	 - offsetof the member
+ * @param normalized - Wheter or not integers are normalized to 0 - 1 (or -1 - 1) in the shader
+ */
+template<typename Member>
+constexpr VertexBufferElement makeVertexBufferElement(std::size_t offset, bool normalized)
+{
+	return { VertexComponentType<typename VertexAttribute<Member>::Component>::value,
+			 VertexAttribute<Member>::count,
+			 (unsigned char)(normalized ? GL_TRUE : GL_FALSE),
+			 (unsigned int)offset };
+}
+
+#define VERTEX_BUFFER_ELEMENT(Vertex, member, normalized) \
+	makeVertexBufferElement<decltype(Vertex::member)>(offsetof(Vertex, member), normalized)
 
-	template<>
-	void Push<unsigned char>(unsigned int count)
+/**
+ * @brief The layout of a vertex struct, the attributes in the order of their shader locations.
+ * 		  Must be specialized for every vertex struct, with a static constexpr elements array.
+ * @see Vertex.h
+ */
+template<typename Vertex>
+struct VertexBufferLayout;
+
+/**
+ * @brief Checks at compile time that a vertex's elements follow each other without gaps,
+ * 		  and that together they make up the whole vertex, so that the stride is sizeof(Vertex).
+ * 
+ */
+template<typename Vertex>
+constexpr bool isTightVertexLayout()
+{
+	unsigned int offset = 0;
+	for (std::size_t i = 0; i < sizeof(VertexBufferLayout<Vertex>::elements) / sizeof(VertexBufferElement); i++)
 	{
-		m_Elements.push_back({ GL_UNSIGNED_BYTE,count,GL_TRUE });
-		m_Stride += count * VertexBufferElement::getSizeOfType(GL_UNSIGNED_BYTE);
+		const VertexBufferElement& element = VertexBufferLayout<Vertex>::elements[i];
+		if (element.getSize() == 0 || element.offset != offset)
+			return false;
+		offset += element.getSize();
 	}
-
-	inline const std::vector<VertexBufferElement> getElements() const { return m_Elements; }
-	inline unsigned int getStride() const { return m_Stride; }
-};
+	return offset == sizeof(Vertex);
+}